@@ -0,0 +1,156 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de LRUCache contra uma LRU feita à mão sobre DoublyLinkedList
+// (find em O(n)) e contra std::list + std::unordered_map.
+// Compilar: g++ -O2 -std=c++14 bench_lru_cache.cpp -o bench_lru_cache
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "lru_cache.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Entrada da LRU feita à mão; a comparação só olha a chave
+struct Pair {
+  int key;
+  int value;
+  bool operator==(const Pair& other) const { return key == other.key; }
+  bool operator!=(const Pair& other) const { return key != other.key; }
+};
+
+//! LRU sobre DoublyLinkedList, localizando a chave com find
+class ListLRU {
+ public:
+  explicit ListLRU(std::size_t capacity): capacity_{capacity} {}
+  bool get(int key, int& value) {
+    auto index = list_.find(Pair{key, 0});
+    if (index == list_.size()) {
+      return false;
+    }
+    auto pair = list_.pop(index);
+    value = pair.value;
+    list_.push_front(pair);
+    return true;
+  }
+  void put(int key, int value) {
+    auto index = list_.find(Pair{key, 0});
+    if (index != list_.size()) {
+      list_.pop(index);
+    }
+    list_.push_front(Pair{key, value});
+    if (list_.size() > capacity_) {
+      list_.pop_back();
+    }
+  }
+
+ private:
+  structures::DoublyLinkedList<Pair> list_;
+  std::size_t capacity_;
+};
+
+//! LRU sobre std::list + std::unordered_map
+class StdLRU {
+ public:
+  explicit StdLRU(std::size_t capacity): capacity_{capacity} {}
+  bool get(int key, int& value) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return false;
+    }
+    order_.splice(order_.begin(), order_, found->second);
+    value = found->second->second;
+    return true;
+  }
+  void put(int key, int value) {
+    auto found = index_.find(key);
+    if (found != index_.end()) {
+      found->second->second = value;
+      order_.splice(order_.begin(), order_, found->second);
+      return;
+    }
+    order_.emplace_front(key, value);
+    index_[key] = order_.begin();
+    if (order_.size() > capacity_) {
+      index_.erase(order_.back().first);
+      order_.pop_back();
+    }
+  }
+
+ private:
+  std::list<std::pair<int, int>> order_;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index_;
+  std::size_t capacity_;
+};
+
+//! Adapta LRUCache à interface das outras
+class CacheLRU {
+ public:
+  explicit CacheLRU(std::size_t capacity): cache_{capacity} {}
+  bool get(int key, int& value) {
+    auto found = cache_.get(key);
+    if (found == nullptr) {
+      return false;
+    }
+    value = *found;
+    return true;
+  }
+  void put(int key, int value) {
+    cache_.put(key, value);
+  }
+
+ private:
+  structures::LRUCache<int, int> cache_;
+};
+
+//! Leituras com falta preenchida por put; chaves em 2 * capacity
+template<typename Cache>
+double run(std::size_t capacity, const std::vector<int>& keys,
+           long long& checksum) {
+  Cache cache{capacity};
+  return measure([&] {
+    for (auto key : keys) {
+      int value;
+      if (cache.get(key, value)) {
+        checksum += value;
+      } else {
+        cache.put(key, key);
+      }
+    }
+  });
+}
+
+int main() {
+  const auto operations = 200000u;
+  std::printf("tempos em ms; %u get/put, chaves em 2 * capacidade\n",
+              operations);
+  for (auto capacity : {100u, 1000u, 10000u, 100000u}) {
+    std::srand(42);
+    std::vector<int> keys;
+    for (auto i = 0u; i < operations; i++) {
+      keys.push_back(std::rand() % (2 * static_cast<int>(capacity)));
+    }
+    long long checksum = 0;
+    auto cache = run<CacheLRU>(capacity, keys, checksum);
+    auto standard = run<StdLRU>(capacity, keys, checksum);
+    if (capacity <= 1000u) {
+      auto list = run<ListLRU>(capacity, keys, checksum);
+      std::printf("capacidade=%-7u LRUCache %8.2f  std %8.2f  "
+                  "DoublyLinkedList+find %9.2f  (%lld)\n", capacity, cache,
+                  standard, list, checksum);
+    } else {
+      std::printf("capacidade=%-7u LRUCache %8.2f  std %8.2f  (%lld)\n",
+                  capacity, cache, standard, checksum);
+    }
+  }
+  return 0;
+}
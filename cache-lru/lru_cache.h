@@ -0,0 +1,416 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_LRU_CACHE_H
+#define STRUCTURES_LRU_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // std::hash, std::function
+#include <memory>  // std::allocator, std::allocator_traits
+#include <utility>  // std::move, std::pair
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+#include "../lista-duplamente-encadeada/doubly_linked_list.h"
+
+namespace structures {
+
+//! Cache LRU: descarta primeiro a entrada usada há mais tempo
+/*!
+  As entradas ficam numa DoublyLinkedList da mais recente (início) para
+  a menos recente (fim): usar uma entrada a move para o início com
+  splice e o descarte é pop_back, ambos O(1). Um índice de endereçamento
+  aberto (sondagem linear, fator de carga até 1/2) leva da chave ao
+  iterador da entrada, então get e put são O(1) esperado.
+  A capacidade é em entradas ou, com um weigher, em bytes (ou qualquer
+  peso que weigher devolva para cada chave e valor).
+*/
+template<typename K, typename V, typename Hash = std::hash<K>,
+         typename Allocator = std::allocator<std::pair<const K, V>>>
+class LRUCache {
+ public:
+  //! Peso de uma entrada; vazio: cada entrada pesa 1
+  using Weigher = std::function<std::size_t(const K&, const V&)>;
+
+  //! Construtor, até capacity entradas
+  explicit LRUCache(std::size_t capacity);
+  //! Construtor, até capacity de peso somado pelo weigher
+  LRUCache(std::size_t capacity, Weigher weigher);
+  //! Construtor, entradas e índice reservados com allocator
+  LRUCache(std::size_t capacity, Weigher weigher,
+           const Allocator& allocator);
+  //! Não copiável: o índice aponta para os nós da própria lista
+  LRUCache(const LRUCache&) = delete;
+  //! Não copiável
+  LRUCache& operator=(const LRUCache&) = delete;
+  //! Valor de key, tornando-a a mais recente (nullptr: ausente)
+  V* get(const K& key);
+  //! Valor de key sem mudar a ordem nem os contadores (nullptr: ausente)
+  const V* peek(const K& key) const;
+  //! Verifica se contém key
+  bool contains(const K& key) const;
+  //! Insere ou troca o valor de key; false se ela sozinha não cabe
+  bool put(const K& key, V value);
+  //! Retira key; false se ausente
+  bool erase(const K& key);
+  //! Limpa o cache (os contadores continuam)
+  void clear();
+  //! Verifica cache vazio
+  bool empty() const;
+  //! Número de entradas
+  std::size_t size() const;
+  //! Peso somado das entradas
+  std::size_t weight() const;
+  //! Peso máximo
+  std::size_t capacity() const;
+  //! Buscas por get que acharam a chave
+  std::size_t hits() const;
+  //! Buscas por get que não acharam a chave
+  std::size_t misses() const;
+  //! Entradas descartadas para abrir espaço
+  std::size_t evictions() const;
+  //! Zera hits, misses e evictions
+  void reset_stats();
+
+ private:
+  //! Entrada da lista
+  struct Entry {
+    //! Construtor
+    Entry(const K& key, V&& value, std::size_t weight, std::size_t hash):
+      key{key},
+      value{std::move(value)},
+      weight{weight},
+      hash{hash}
+    {}
+    //! Chave
+    K key;
+    //! Valor
+    V value;
+    //! Peso contado em weight_
+    std::size_t weight;
+    //! Hash misturado da chave, para achar a entrada no índice ao descartar
+    std::size_t hash;
+  };
+  //! Alocador das entradas
+  using EntryAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+  //! Entradas, da mais recente para a menos recente
+  using List = DoublyLinkedList<Entry, EntryAllocator>;
+  //! Posição do índice
+  struct Slot {
+    //! Entrada (vale só se used)
+    typename List::Iterator entry;
+    //! Hash misturado da chave, guardado para sondar e crescer sem recalcular
+    std::size_t hash{0u};
+    //! Ocupada
+    bool used{false};
+  };
+  //! Alocador do índice
+  using SlotAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+  //! Hash de key, misturado para a sondagem usar os bits baixos
+  std::size_t hash_of(const K& key) const;
+  //! Posição de key no índice (slots_.size(): ausente)
+  std::size_t find_slot(const K& key, std::size_t hash) const;
+  //! Posição de entry, que está no índice
+  std::size_t slot_of(typename List::Iterator entry) const;
+  //! Põe entry no índice, crescendo se preciso
+  void index(typename List::Iterator entry, std::size_t hash);
+  //! Tira a posição slot do índice, puxando as seguintes para trás
+  void unindex(std::size_t slot);
+  //! Dobra o índice e reposiciona as entradas
+  void grow();
+  //! Retira a entrada da posição slot
+  void remove_slot(std::size_t slot);
+  //! Descarta as menos recentes até o peso caber na capacidade
+  void evict_to_fit();
+  //! Peso de key e value
+  std::size_t weigh(const K& key, const V& value) const;
+
+  //! Entradas, da mais recente para a menos recente
+  List entries_;
+  //! Índice de endereçamento aberto, tamanho potência de 2 (ou vazio)
+  std::vector<Slot, SlotAllocator> slots_;
+  //! Função de hash
+  Hash hash_;
+  //! Peso de cada entrada
+  Weigher weigher_;
+  //! Peso máximo
+  std::size_t capacity_;
+  //! Peso somado das entradas
+  std::size_t weight_{0u};
+  //! Buscas que acharam
+  std::size_t hits_{0u};
+  //! Buscas que não acharam
+  std::size_t misses_{0u};
+  //! Entradas descartadas
+  std::size_t evictions_{0u};
+};
+
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! LRUCache com entradas e índice em um std::pmr::memory_resource
+template<typename K, typename V, typename Hash = std::hash<K>>
+using LRUCache = structures::LRUCache<K, V, Hash,
+    std::pmr::polymorphic_allocator<std::pair<const K, V>>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename K, typename V, typename Hash, typename Allocator>
+structures::LRUCache<K, V, Hash, Allocator>::LRUCache(std::size_t capacity):
+  LRUCache(capacity, Weigher{})
+{}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+structures::LRUCache<K, V, Hash, Allocator>::LRUCache(
+    std::size_t capacity, Weigher weigher):
+  LRUCache(capacity, std::move(weigher), Allocator())
+{}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+structures::LRUCache<K, V, Hash, Allocator>::LRUCache(
+    std::size_t capacity, Weigher weigher, const Allocator& allocator):
+  entries_{EntryAllocator(allocator)},
+  slots_{SlotAllocator(allocator)},
+  weigher_{std::move(weigher)},
+  capacity_{capacity}
+{}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+V* structures::LRUCache<K, V, Hash, Allocator>::get(const K& key) {
+  auto slot = find_slot(key, hash_of(key));
+  if (slot == slots_.size()) {
+    misses_++;
+    return nullptr;
+  }
+  hits_++;
+  auto entry = slots_[slot].entry;
+  entries_.splice(entries_.begin(), entries_, entry);
+  return &entry->value;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+const V* structures::LRUCache<K, V, Hash, Allocator>::peek(
+    const K& key) const {
+  auto slot = find_slot(key, hash_of(key));
+  if (slot == slots_.size()) {
+    return nullptr;
+  }
+  return &slots_[slot].entry->value;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+bool structures::LRUCache<K, V, Hash, Allocator>::contains(
+    const K& key) const {
+  return find_slot(key, hash_of(key)) != slots_.size();
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+bool structures::LRUCache<K, V, Hash, Allocator>::put(const K& key, V value) {
+  auto hash = hash_of(key);
+  auto slot = find_slot(key, hash);
+  auto weight = weigh(key, value);
+  if (weight > capacity_) {
+    // não cabe nem sozinha: o valor antigo também sai
+    if (slot != slots_.size()) {
+      remove_slot(slot);
+    }
+    return false;
+  }
+  if (slot != slots_.size()) {
+    auto entry = slots_[slot].entry;
+    entry->value = std::move(value);
+    weight_ = weight_ - entry->weight + weight;
+    entry->weight = weight;
+    entries_.splice(entries_.begin(), entries_, entry);
+  } else {
+    entries_.emplace_front(key, std::move(value), weight, hash);
+    weight_ += weight;
+    index(entries_.begin(), hash);
+  }
+  evict_to_fit();
+  return true;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+bool structures::LRUCache<K, V, Hash, Allocator>::erase(const K& key) {
+  auto slot = find_slot(key, hash_of(key));
+  if (slot == slots_.size()) {
+    return false;
+  }
+  remove_slot(slot);
+  return true;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::clear() {
+  entries_.clear();
+  for (auto& slot : slots_) {
+    slot.used = false;
+  }
+  weight_ = 0;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+bool structures::LRUCache<K, V, Hash, Allocator>::empty() const {
+  return entries_.empty();
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::size() const {
+  return entries_.size();
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::weight() const {
+  return weight_;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::capacity() const {
+  return capacity_;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::hits() const {
+  return hits_;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::misses() const {
+  return misses_;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::evictions() const {
+  return evictions_;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::reset_stats() {
+  hits_ = 0;
+  misses_ = 0;
+  evictions_ = 0;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::hash_of(
+    const K& key) const {
+  // finalizador do MurmurHash3: std::hash de inteiros costuma ser a
+  // identidade, e a sondagem só olha os bits baixos
+  auto hash = static_cast<std::uint64_t>(hash_(key));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return static_cast<std::size_t>(hash);
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::find_slot(
+    const K& key, std::size_t hash) const {
+  if (slots_.empty()) {
+    return slots_.size();
+  }
+  auto mask = slots_.size() - 1;
+  for (auto i = hash & mask; slots_[i].used; i = (i + 1) & mask) {
+    if (slots_[i].hash == hash && slots_[i].entry->key == key) {
+      return i;
+    }
+  }
+  return slots_.size();
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::slot_of(
+    typename List::Iterator entry) const {
+  // compara só a entrada: nem hash_ nem operator== da chave
+  auto mask = slots_.size() - 1;
+  auto i = entry->hash & mask;
+  while (!slots_[i].used || slots_[i].entry != entry) {
+    i = (i + 1) & mask;
+  }
+  return i;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::index(
+    typename List::Iterator entry, std::size_t hash) {
+  // fator de carga até 1/2: sempre sobra posição livre para a sondagem
+  if (2 * size() > slots_.size()) {
+    grow();
+  }
+  auto mask = slots_.size() - 1;
+  auto i = hash & mask;
+  while (slots_[i].used) {
+    i = (i + 1) & mask;
+  }
+  slots_[i].entry = entry;
+  slots_[i].hash = hash;
+  slots_[i].used = true;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::unindex(std::size_t slot) {
+  // sem lápides: puxa para o buraco as entradas seguintes cuja posição
+  // de origem não fica entre o buraco e elas
+  auto mask = slots_.size() - 1;
+  auto hole = slot;
+  for (auto i = (hole + 1) & mask; slots_[i].used; i = (i + 1) & mask) {
+    auto home = slots_[i].hash & mask;
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      slots_[hole] = slots_[i];
+      hole = i;
+    }
+  }
+  slots_[hole].used = false;
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::grow() {
+  std::vector<Slot, SlotAllocator> old{slots_.get_allocator()};
+  old.swap(slots_);
+  slots_.resize(old.empty() ? 8u : 2 * old.size());
+  auto mask = slots_.size() - 1;
+  for (const auto& slot : old) {
+    if (slot.used) {
+      auto i = slot.hash & mask;
+      while (slots_[i].used) {
+        i = (i + 1) & mask;
+      }
+      slots_[i] = slot;
+    }
+  }
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::remove_slot(
+    std::size_t slot) {
+  auto entry = slots_[slot].entry;
+  unindex(slot);
+  weight_ -= entry->weight;
+  entries_.pop(entry);
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+void structures::LRUCache<K, V, Hash, Allocator>::evict_to_fit() {
+  while (weight_ > capacity_) {
+    remove_slot(slot_of(--entries_.end()));
+    evictions_++;
+  }
+}
+
+template<typename K, typename V, typename Hash, typename Allocator>
+std::size_t structures::LRUCache<K, V, Hash, Allocator>::weigh(
+    const K& key, const V& value) const {
+  return weigher_ ? weigher_(key, value) : 1u;
+}
+
+#endif
@@ -0,0 +1,245 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#include "gtest/gtest.h"
+#include "lru_cache.h"
+
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+// todas as chaves no mesmo balde: só a sondagem as separa
+struct CollidingHash {
+    std::size_t operator()(int) const { return 42u; }
+};
+
+// conta as chamadas, para ver quem recalcula o hash
+struct CountingHash {
+    std::size_t operator()(int key) const {
+        calls++;
+        return std::hash<int>{}(key);
+    }
+    static std::size_t calls;
+};
+std::size_t CountingHash::calls = 0;
+}  // namespace
+
+class LRUCacheTest: public ::testing::Test {
+protected:
+    structures::LRUCache<int, std::string> cache{3u};
+};
+
+TEST_F(LRUCacheTest, PutAndGet) {
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(nullptr, cache.get(1));
+    ASSERT_TRUE(cache.put(1, "um"));
+    ASSERT_TRUE(cache.put(2, "dois"));
+    ASSERT_EQ(2u, cache.size());
+    ASSERT_EQ("um", *cache.get(1));
+    ASSERT_EQ("dois", *cache.get(2));
+    *cache.get(2) = "DOIS";
+    ASSERT_EQ("DOIS", *cache.peek(2));
+    ASSERT_TRUE(cache.contains(1));
+    ASSERT_FALSE(cache.contains(3));
+}
+
+TEST_F(LRUCacheTest, EvictsLeastRecentlyUsed) {
+    cache.put(1, "um");
+    cache.put(2, "dois");
+    cache.put(3, "três");
+    cache.get(1);  // 2 passa a ser a menos recente
+    cache.put(4, "quatro");
+    ASSERT_EQ(3u, cache.size());
+    ASSERT_FALSE(cache.contains(2));
+    ASSERT_TRUE(cache.contains(1));
+    ASSERT_EQ(1u, cache.evictions());
+    cache.put(3, "TRÊS");  // atualizar também conta como uso
+    cache.put(5, "cinco");
+    ASSERT_FALSE(cache.contains(1));
+    ASSERT_EQ("TRÊS", *cache.peek(3));
+    ASSERT_EQ(3u, cache.size());
+    ASSERT_EQ(2u, cache.evictions());
+}
+
+TEST_F(LRUCacheTest, PeekKeepsOrder) {
+    cache.put(1, "um");
+    cache.put(2, "dois");
+    cache.put(3, "três");
+    ASSERT_EQ("um", *cache.peek(1));
+    cache.put(4, "quatro");
+    ASSERT_FALSE(cache.contains(1));
+    ASSERT_EQ(nullptr, cache.peek(1));
+    ASSERT_EQ(0u, cache.hits());
+    ASSERT_EQ(0u, cache.misses());
+}
+
+TEST_F(LRUCacheTest, EraseAndClear) {
+    cache.put(1, "um");
+    cache.put(2, "dois");
+    ASSERT_TRUE(cache.erase(1));
+    ASSERT_FALSE(cache.erase(1));
+    ASSERT_EQ(1u, cache.size());
+    ASSERT_EQ(1u, cache.weight());
+    cache.put(3, "três");
+    cache.put(4, "quatro");
+    ASSERT_EQ(0u, cache.evictions());
+    cache.clear();
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(0u, cache.weight());
+    ASSERT_FALSE(cache.contains(2));
+    cache.put(2, "dois");
+    ASSERT_EQ("dois", *cache.get(2));
+}
+
+TEST_F(LRUCacheTest, Counters) {
+    cache.put(1, "um");
+    cache.get(1);
+    cache.get(1);
+    cache.get(2);
+    ASSERT_EQ(2u, cache.hits());
+    ASSERT_EQ(1u, cache.misses());
+    cache.reset_stats();
+    ASSERT_EQ(0u, cache.hits());
+    ASSERT_EQ(0u, cache.misses());
+    ASSERT_EQ(0u, cache.evictions());
+}
+
+TEST(LRUCacheBytesTest, CapacityByWeight) {
+    structures::LRUCache<int, std::string> cache{
+        10u, [](const int&, const std::string& value) {
+            return value.size();
+        }};
+    ASSERT_TRUE(cache.put(1, "aaaa"));
+    ASSERT_TRUE(cache.put(2, "bbbb"));
+    ASSERT_EQ(8u, cache.weight());
+    ASSERT_TRUE(cache.put(3, "cc"));
+    ASSERT_EQ(10u, cache.weight());
+    ASSERT_EQ(0u, cache.evictions());
+    // 1 e 2 saem para caber 6 bytes
+    ASSERT_TRUE(cache.put(4, "dddddd"));
+    ASSERT_FALSE(cache.contains(1));
+    ASSERT_FALSE(cache.contains(2));
+    ASSERT_EQ(8u, cache.weight());
+    ASSERT_EQ(2u, cache.evictions());
+    // mudar o valor muda o peso
+    ASSERT_TRUE(cache.put(3, "c"));
+    ASSERT_EQ(7u, cache.weight());
+    // maior que a capacidade: não entra e o valor antigo sai
+    ASSERT_FALSE(cache.put(4, "eeeeeeeeeee"));
+    ASSERT_FALSE(cache.contains(4));
+    ASSERT_EQ(1u, cache.weight());
+    ASSERT_EQ(1u, cache.size());
+}
+
+TEST(LRUCacheCollisionTest, ProbingAndRemoval) {
+    structures::LRUCache<int, int, CollidingHash> cache{64u};
+    for (auto i = 0; i < 64; ++i) {
+        ASSERT_TRUE(cache.put(i, i * 10));
+    }
+    // retirar do meio da sequência não pode esconder as seguintes
+    for (auto i = 0; i < 64; i += 3) {
+        ASSERT_TRUE(cache.erase(i));
+    }
+    for (auto i = 0; i < 64; ++i) {
+        if (i % 3 == 0) {
+            ASSERT_FALSE(cache.contains(i));
+        } else {
+            ASSERT_EQ(i * 10, *cache.get(i));
+        }
+    }
+}
+
+TEST(LRUCacheHashTest, EvictionDoesNotRehash) {
+    structures::LRUCache<int, int, CountingHash> cache{4u};
+    for (auto i = 0; i < 4; ++i) {
+        cache.put(i, i);
+    }
+    CountingHash::calls = 0;
+    // cada put calcula o hash da chave nova uma vez; a descartada não
+    for (auto i = 4; i < 100; ++i) {
+        cache.put(i, i);
+    }
+    ASSERT_EQ(96u, CountingHash::calls);
+    ASSERT_EQ(96u, cache.evictions());
+    for (auto i = 96; i < 100; ++i) {
+        ASSERT_EQ(i, *cache.peek(i));
+    }
+}
+
+TEST(LRUCacheModelTest, MatchesReference) {
+    // modelo: std::list da mais recente para a menos recente
+    const std::size_t capacity = 50u;
+    structures::LRUCache<int, int> cache{capacity};
+    std::list<std::pair<int, int>> order;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> where;
+    std::size_t evictions = 0;
+    std::srand(3);
+    for (auto step = 0; step < 20000; ++step) {
+        auto key = std::rand() % 120;
+        auto found = where.find(key);
+        switch (std::rand() % 3) {
+        case 0: {
+            auto value = cache.get(key);
+            if (found == where.end()) {
+                ASSERT_EQ(nullptr, value);
+            } else {
+                ASSERT_NE(nullptr, value);
+                ASSERT_EQ(found->second->second, *value);
+                order.splice(order.begin(), order, found->second);
+            }
+            break;
+        }
+        case 1:
+            ASSERT_TRUE(cache.put(key, step));
+            if (found != where.end()) {
+                order.erase(found->second);
+            }
+            order.emplace_front(key, step);
+            where[key] = order.begin();
+            if (order.size() > capacity) {
+                where.erase(order.back().first);
+                order.pop_back();
+                evictions++;
+            }
+            break;
+        default:
+            ASSERT_EQ(found != where.end(), cache.erase(key));
+            if (found != where.end()) {
+                order.erase(found->second);
+                where.erase(found);
+            }
+        }
+        ASSERT_EQ(order.size(), cache.size());
+    }
+    ASSERT_EQ(evictions, cache.evictions());
+    for (const auto& entry : order) {
+        ASSERT_EQ(entry.second, *cache.peek(entry.first));
+    }
+}
+
+#if __cplusplus >= 201703L
+TEST(LRUCachePmrTest, MonotonicBuffer) {
+    // sem recurso de reserva: entradas e índice têm de vir do buffer
+    alignas(std::max_align_t) char buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::LRUCache<int, int> cache{
+        100u, {}, &resource};
+    for (auto i = 0; i < 300; ++i) {
+        cache.put(i, i);
+    }
+    ASSERT_EQ(100u, cache.size());
+    ASSERT_EQ(200u, cache.evictions());
+    ASSERT_EQ(299, *cache.get(299));
+}
+#endif
@@ -1,19 +1,35 @@
 //! Copyright [2021] Gabriel de Vargas Coelho
+#ifndef STRUCTURES_LINKED_QUEUE
+#define STRUCTURES_LINKED_QUEUE
+
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
 //! Classe fila encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class LinkedQueue {
  public:
   //! Construtor
   LinkedQueue();
+  //! Construtor, nós reservados com allocator
+  explicit LinkedQueue(const Allocator& allocator);
   //! Destrutor
   ~LinkedQueue();
   //! Limpa fila
   void clear();
   //! Enfileirar
   void enqueue(const T& data);
+  //! Enfileirar, movendo o dado
+  void enqueue(T&& data);
+  //! Enfileirar construindo no fim
+  template<typename... Args>
+  void emplace(Args&&... args);
   //! Desenfileirar
   T dequeue();
   //! Início da fila
@@ -29,14 +45,10 @@ class LinkedQueue {
   //! Classe nó
   class Node {
    public:
-    //! Construtor
-    explicit Node(const T& data):
-      data_{data}
-    {}
-    //! Construtor parametrizado
-    Node(const T& data, Node* next):
-      data_{data},
-      next_{next}
+    //! Construtor, dado construído no lugar
+    template<typename... Args>
+    explicit Node(Args&&... args):
+      data_(std::forward<Args>(args)...)
     {}
     //! Retorna dado
     T& data() {
@@ -65,6 +77,18 @@ class LinkedQueue {
     //! Próximo nó
     Node* next_{nullptr};
   };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! Reserva e constrói um nó
+  template<typename... Args>
+  Node* create_node(Args&&... args);
+  //! Destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! Reserva os nós
+  NodeAllocator allocator_;
   //! Início da fila
   Node* head;
   //! Fim da fila
@@ -73,26 +97,46 @@ class LinkedQueue {
   std::size_t size_;
 };
 
-}  //  namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! LinkedQueue com nós em um std::pmr::memory_resource
 template<typename T>
-structures::LinkedQueue<T>::LinkedQueue() {
+using LinkedQueue =
+    structures::LinkedQueue<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  //  namespace structures
+
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::LinkedQueue() {
   head = nullptr;
   tail = nullptr;
   size_ = 0;
 }
 
-template<typename T>
-structures::LinkedQueue<T>::~LinkedQueue() {
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::LinkedQueue(const Allocator& allocator):
+  allocator_{allocator}
+{
+  head = nullptr;
+  tail = nullptr;
+  size_ = 0;
+}
+
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::~LinkedQueue() {
   clear();
 }
 
-template<typename T>
-void structures::LinkedQueue<T>::clear() {
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::clear() {
   Node* current = head;
   while (current != nullptr) {
     auto next = current->next();
-    delete current;
+    destroy_node(current);
     current = next;
   }
   head = nullptr;
@@ -100,9 +144,20 @@ void structures::LinkedQueue<T>::clear() {
   size_ = 0;
 }
 
-template<typename T>
-void structures::LinkedQueue<T>::enqueue(const T& data) {
-  Node* element = new Node(data);
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::enqueue(const T& data) {
+  emplace(data);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::enqueue(T&& data) {
+  emplace(std::move(data));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::LinkedQueue<T, Allocator>::emplace(Args&&... args) {
+  Node* element = create_node(std::forward<Args>(args)...);
   if (element == nullptr) {
     throw std::out_of_range("Fila cheia");
   }
@@ -115,44 +170,66 @@ void structures::LinkedQueue<T>::enqueue(const T& data) {
   size_++;
 }
 
-template<typename T>
-T structures::LinkedQueue<T>::dequeue() {
+template<typename T, typename Allocator>
+T structures::LinkedQueue<T, Allocator>::dequeue() {
   if (empty()) {
     throw std::out_of_range("Fila vazia");
   }
   auto current_head = head;
-  auto data = current_head->data();
+  auto data = std::move(current_head->data());
   head = current_head->next();
   if (size() == 1) {
     tail = nullptr;
   }
-  delete current_head;
+  destroy_node(current_head);
   size_--;
   return data;
 }
 
-template<typename T>
-T& structures::LinkedQueue<T>::front() const {
+template<typename T, typename Allocator>
+T& structures::LinkedQueue<T, Allocator>::front() const {
   if (empty()) {
     throw std::out_of_range("Fila vazia");
   }
   return head->data();
 }
 
-template<typename T>
-T& structures::LinkedQueue<T>::back() const {
+template<typename T, typename Allocator>
+T& structures::LinkedQueue<T, Allocator>::back() const {
   if (empty()) {
     throw std::out_of_range("Fila vazia");
   }
   return tail->data();
 }
 
-template<typename T>
-bool structures::LinkedQueue<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::LinkedQueue<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template<typename T>
-std::size_t structures::LinkedQueue<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedQueue<T, Allocator>::size() const {
   return size_;
 }
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::LinkedQueue<T, Allocator>::Node*
+structures::LinkedQueue<T, Allocator>::create_node(Args&&... args) {
+  auto node = NodeTraits::allocate(allocator_, 1);
+  try {
+    NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
+#endif
@@ -2,6 +2,13 @@
 
 #include "gtest/gtest.h"
 #include "linked_queue.h"
+#include "../lista-encadeada/node_pool.h"
+
+#include <memory>
+#include <string>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -69,3 +76,78 @@ TEST_F(LinkedQueueTest, NotEmptyQueue) {
     ASSERT_THROW(queue.back(), std::out_of_range);
     ASSERT_THROW(queue.dequeue(), std::out_of_range);
 }
+
+TEST(LinkedQueueMoveTest, MovedThroughEnds) {
+    // entra pelo fim e sai pelo início sem cópia, inclusive depois de a
+    // fila esvaziar e o fim voltar a ser o início
+    structures::LinkedQueue<std::string> container{};
+    for (auto round = 0; round < 3; ++round) {
+        std::string data(40, static_cast<char>('a' + round));
+        auto buffer = data.data();
+        container.enqueue(std::move(data));
+        container.emplace(2u, 'z');
+        ASSERT_EQ("zz", container.back());
+        ASSERT_EQ(buffer, container.dequeue().data());
+        ASSERT_EQ("zz", container.dequeue());
+        ASSERT_TRUE(container.empty());
+    }
+    structures::LinkedQueue<std::unique_ptr<int>> pointers{};
+    pointers.emplace(new int(0));
+    pointers.enqueue(std::unique_ptr<int>(new int(1)));
+    ASSERT_EQ(0, *pointers.dequeue());
+    ASSERT_EQ(1, *pointers.back());
+}
+
+TEST(LinkedQueuePoolTest, FrontBlockBecomesBack) {
+    // numa fila que anda, o bloco que dequeue tira da frente é o que o
+    // enqueue seguinte liga atrás
+    structures::NodePool pool;
+    {
+        structures::PoolAllocator<std::string> allocator{pool};
+        structures::LinkedQueue<std::string,
+            structures::PoolAllocator<std::string>> container{allocator};
+        for (auto i = 0; i < 100; i++) {
+            container.enqueue(std::to_string(i));
+        }
+        auto slabs = pool.slabs();
+        for (auto i = 100; i < 1100; i++) {
+            auto front = &container.front();
+            ASSERT_EQ(std::to_string(i - 100), container.dequeue());
+            container.enqueue(std::to_string(i));
+            ASSERT_EQ(front, &container.back());
+        }
+        ASSERT_EQ(100u, pool.used());
+        ASSERT_EQ(slabs, pool.slabs());
+    }
+    ASSERT_EQ(0u, pool.used());
+}
+
+#if __cplusplus >= 201703L
+TEST(LinkedQueuePmrTest, DequeuedNodesServeEnqueue) {
+    // com o recurso esgotado, só os nós devolvidos por dequeue servem os
+    // próximos enqueue: a fila anda sem crescer e mantém a ordem
+    alignas(std::max_align_t) char buffer[1 << 13];
+    std::pmr::monotonic_buffer_resource upstream{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    std::pmr::unsynchronized_pool_resource resource{&upstream};
+    structures::pmr::LinkedQueue<int> container{&resource};
+    auto pushed = 0;
+    try {
+        for (; pushed < 10000; pushed++) {
+            container.enqueue(pushed);
+        }
+    } catch (const std::bad_alloc&) {
+    }
+    ASSERT_GT(pushed, 0);
+    ASSERT_LT(pushed, 10000);
+    ASSERT_THROW(container.enqueue(-1), std::bad_alloc);
+    ASSERT_EQ(pushed - 1, container.back());
+    for (auto i = pushed; i < 10 * pushed; i++) {
+        ASSERT_EQ(i - pushed, container.dequeue());
+        container.enqueue(i);
+        ASSERT_EQ(i, container.back());
+    }
+    ASSERT_EQ(static_cast<std::size_t>(pushed), container.size());
+}
+
+#endif
@@ -3,11 +3,17 @@
 #define STRUCTURES_ARRAY_QUEUE_H
 
 #include <cstdint>  // std::size_t
+#include <memory>  // std::allocator, std::allocator_traits
 #include <stdexcept>  // C++ Exceptions
+#include <type_traits>  // std::is_trivially_destructible
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 //! classe ArrayQueue
 class ArrayQueue {
  public:
@@ -15,10 +21,19 @@ class ArrayQueue {
     ArrayQueue();
     //! construtor com parametro
     explicit ArrayQueue(std::size_t max);
+    //! construtor padrão, vetor base reservado com allocator
+    explicit ArrayQueue(const Allocator& allocator);
+    //! construtor com parametro, vetor base reservado com allocator
+    ArrayQueue(std::size_t max, const Allocator& allocator);
     //! destrutor padrao
     ~ArrayQueue();
     //! metodo enfileirar
     void enqueue(const T& data);
+    //! metodo enfileirar, movendo o dado
+    void enqueue(T&& data);
+    //! metodo enfileirar construindo no fim
+    template<typename... Args>
+    void emplace(Args&&... args);
     //! metodo desenfileirar
     T dequeue();
     //! metodo retorna o ultimo
@@ -35,6 +50,12 @@ class ArrayQueue {
     bool full();
 
  private:
+    //! reserva o vetor base com size elementos construídos
+    T* allocate_contents(std::size_t size);
+    //! destrói os elementos e devolve o vetor base
+    void deallocate_contents();
+    //! alocador do vetor base
+    Allocator allocator_;
     //! vetor base
     T* contents;
     //! tamanho atual da fila
@@ -47,58 +68,98 @@ class ArrayQueue {
     static const auto DEFAULT_SIZE = 10u;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! ArrayQueue com vetor base em um std::pmr::memory_resource
+template<typename T>
+using ArrayQueue =
+    structures::ArrayQueue<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
 #endif
 
-template <typename T>
-structures::ArrayQueue<T>::ArrayQueue() {
-  contents = new T[DEFAULT_SIZE];
+template <typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue() {
+  contents = allocate_contents(DEFAULT_SIZE);
   size_ = 0;
   max_size_ = DEFAULT_SIZE;
   begin_ = 0;
   end_ = -1;
 }
 
-template <typename T>
-structures::ArrayQueue<T>::ArrayQueue(std::size_t max) {
-  contents = new T[max];
+template <typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(std::size_t max) {
+  contents = allocate_contents(max);
   size_ = 0;
   max_size_ = max;
   begin_ = 0;
   end_ = -1;
 }
 
-template <typename T>
-structures::ArrayQueue<T>::~ArrayQueue() {
-  delete [] contents;
+template <typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(const Allocator& allocator):
+  ArrayQueue(std::size_t(DEFAULT_SIZE), allocator)
+{}
+
+template <typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(std::size_t max,
+                                                 const Allocator& allocator):
+  allocator_{allocator}
+{
+  contents = allocate_contents(max);
+  size_ = 0;
+  max_size_ = max;
+  begin_ = 0;
+  end_ = -1;
 }
 
-template <typename T>
-void structures::ArrayQueue<T>::enqueue(const T& data) {
+template <typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::~ArrayQueue() {
+  deallocate_contents();
+}
+
+template <typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::enqueue(const T& data) {
+  emplace(data);
+}
+
+template <typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::enqueue(T&& data) {
+  emplace(std::move(data));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void structures::ArrayQueue<T, Allocator>::emplace(Args&&... args) {
   if (full()) {
     throw std::out_of_range("fila cheia");
   } else {
-    end_ = (end_ + 1) % max_size_;
-    contents[end_] = data;
+    auto end = (end_ + 1) % max_size_;
+    contents[end] = T(std::forward<Args>(args)...);
+    end_ = end;
     size_++;
   }
 }
 
-template <typename T>
-T structures::ArrayQueue<T>::dequeue() {
+template <typename T, typename Allocator>
+T structures::ArrayQueue<T, Allocator>::dequeue() {
   if (empty()) {
     throw std::out_of_range("fila vazia");
   } else {
-    auto data = contents[begin_];
+    auto data = std::move(contents[begin_]);
     begin_ = (begin_ + 1) % max_size_;
     size_--;
     return data;
   }
 }
 
-template <typename T>
-T& structures::ArrayQueue<T>::back() {
+template <typename T, typename Allocator>
+T& structures::ArrayQueue<T, Allocator>::back() {
   if (empty()) {
     throw std::out_of_range("fila vazia");
   } else {
@@ -106,29 +167,62 @@ T& structures::ArrayQueue<T>::back() {
   }
 }
 
-template <typename T>
-void structures::ArrayQueue<T>::clear() {
+template <typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::clear() {
   size_ = 0;
   begin_ = 0;
   end_ = -1;
 }
 
-template <typename T>
-std::size_t structures::ArrayQueue<T>::size() {
+template <typename T, typename Allocator>
+std::size_t structures::ArrayQueue<T, Allocator>::size() {
   return size_;
 }
 
-template <typename T>
-std::size_t structures::ArrayQueue<T>::max_size() {
+template <typename T, typename Allocator>
+std::size_t structures::ArrayQueue<T, Allocator>::max_size() {
   return max_size_;
 }
 
-template <typename T>
-bool structures::ArrayQueue<T>::empty() {
+template <typename T, typename Allocator>
+bool structures::ArrayQueue<T, Allocator>::empty() {
   return size_ == 0;
 }
 
-template <typename T>
-bool structures::ArrayQueue<T>::full() {
+template <typename T, typename Allocator>
+bool structures::ArrayQueue<T, Allocator>::full() {
   return size_ == max_size_;
 }
+
+template <typename T, typename Allocator>
+T* structures::ArrayQueue<T, Allocator>::allocate_contents(std::size_t size) {
+  using Traits = std::allocator_traits<Allocator>;
+  auto data = Traits::allocate(allocator_, size);
+  // como new T[size]: tipos triviais ficam sem inicializar
+  if (!std::is_trivially_default_constructible<T>::value) {
+    std::size_t i = 0;
+    try {
+      for (; i < size; i++) {
+        Traits::construct(allocator_, data + i);
+      }
+    } catch (...) {
+      while (i > 0) {
+        Traits::destroy(allocator_, data + --i);
+      }
+      Traits::deallocate(allocator_, data, size);
+      throw;
+    }
+  }
+  return data;
+}
+
+template <typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::deallocate_contents() {
+  using Traits = std::allocator_traits<Allocator>;
+  if (!std::is_trivially_destructible<T>::value) {
+    for (auto i = 0u; i < max_size_; i++) {
+      Traits::destroy(allocator_, contents + i);
+    }
+  }
+  Traits::deallocate(allocator_, contents, max_size_);
+}
@@ -4,6 +4,12 @@
 #include "gtest/gtest.h"
 #include "./array_queue.h"
 
+#include <memory>
+#include <string>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
 int main(int argc, char* argv[]) {
     std::srand(std::time(NULL));
     ::testing::InitGoogleTest(&argc, argv);
@@ -90,4 +96,53 @@ TEST_F(ArrayQueueTest, MemoryManipulation) {
         queue.enqueue(1);
         queue.dequeue();
     }
-}
\ No newline at end of file
+}
+
+TEST(ArrayQueueMoveTest, MoveOutAfterWrap) {
+    // os índices de início e fim dão a volta no vetor várias vezes; o
+    // que entra e sai pelas posições reaproveitadas é movido, não copiado
+    structures::ArrayQueue<std::unique_ptr<int>> pointers{3u};
+    for (auto i = 0; i < 3; ++i) {
+        pointers.emplace(new int(i));
+    }
+    for (auto i = 3; i < 10; ++i) {
+        ASSERT_EQ(i - 3, *pointers.dequeue());
+        pointers.enqueue(std::unique_ptr<int>(new int(i)));
+        ASSERT_EQ(i, *pointers.back());
+    }
+    for (auto i = 7; i < 10; ++i) {
+        ASSERT_EQ(i, *pointers.dequeue());
+    }
+    structures::ArrayQueue<std::string> container{2u};
+    for (auto round = 0; round < 5; ++round) {
+        std::string data(40, static_cast<char>('a' + round));
+        auto buffer = data.data();
+        container.enqueue(std::move(data));
+        container.emplace(2u, 'z');
+        ASSERT_EQ(buffer, container.dequeue().data());
+        ASSERT_EQ("zz", container.dequeue());
+    }
+}
+
+#if __cplusplus >= 201703L
+TEST(ArrayQueuePmrTest, ContentsInOneAllocation) {
+    // o vetor é reservado inteiro no construtor: 64 ints cabem em um
+    // buffer de 64 ints, e sem memória a falha vem na construção
+    alignas(std::max_align_t) char buffer[64 * sizeof(int)];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    {
+        structures::pmr::ArrayQueue<int> container{64u, &resource};
+        for (auto i = 0; i < 64; i++) {
+            container.enqueue(i);
+        }
+        ASSERT_TRUE(container.full());
+        for (auto i = 0; i < 64; i++) {
+            ASSERT_EQ(i, container.dequeue());
+        }
+        ASSERT_TRUE(container.empty());
+    }
+    using Container = structures::pmr::ArrayQueue<int>;
+    ASSERT_THROW(Container(1u, &resource), std::bad_alloc);
+}
+#endif
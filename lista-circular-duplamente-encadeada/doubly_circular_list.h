@@ -1,29 +1,150 @@
 //! Copyright [2021] Gabriel de Vargas Coelho
-#ifndef STRUCTURES_LINKED_LIST_H
-#define STRUCTURES_LINKED_LIST_H
+#ifndef STRUCTURES_DOUBLY_CIRCULAR_LIST_H
+#define STRUCTURES_DOUBLY_CIRCULAR_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
 //! Classe lista encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class DoublyCircularList {
+ private:
+  class Node;
+
  public:
+  //! Iterador bidirecional; Value é T ou const T
+  /*!
+    Guarda também a posição: numa lista circular o fim é a cabeça depois
+    de size() passos.
+  */
+  template<typename Value>
+  class BasicIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename std::remove_const<Value>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    //! Iterador nulo
+    BasicIterator() = default;
+    //! Converte Iterator em ConstIterator
+    template<typename Other, typename = typename std::enable_if<
+        std::is_same<const Other, Value>::value>::type>
+    BasicIterator(const BasicIterator<Other>& other):  // NOLINT
+      node_{other.node_},
+      index_{other.index_}
+    {}
+    //! Elemento atual
+    reference operator*() const {
+      return node_->data();
+    }
+    //! Elemento atual
+    pointer operator->() const {
+      return &node_->data();
+    }
+    //! Avança para o próximo elemento
+    BasicIterator& operator++() {
+      node_ = node_->next();
+      index_++;
+      return *this;
+    }
+    //! Avança para o próximo elemento
+    BasicIterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+    //! Volta para o elemento anterior
+    BasicIterator& operator--() {
+      node_ = node_->prev();
+      index_--;
+      return *this;
+    }
+    //! Volta para o elemento anterior
+    BasicIterator operator--(int) {
+      auto old = *this;
+      --*this;
+      return old;
+    }
+    //! Compara posições
+    bool operator==(const BasicIterator& other) const {
+      return index_ == other.index_;
+    }
+    //! Compara posições
+    bool operator!=(const BasicIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class DoublyCircularList;
+    template<typename> friend class BasicIterator;
+    //! Node* ou const Node*
+    using NodePointer = typename std::conditional<
+        std::is_const<Value>::value, const Node*, Node*>::type;
+    //! Iterador no nó node, na posição index
+    BasicIterator(NodePointer node, std::size_t index):
+      node_{node},
+      index_{index}
+    {}
+    //! Nó atual
+    NodePointer node_{nullptr};
+    //! Posição atual
+    std::size_t index_{0u};
+  };
+  //! Iterador bidirecional
+  using Iterator = BasicIterator<T>;
+  //! Iterador bidirecional, só leitura
+  using ConstIterator = BasicIterator<const T>;
+
   //! Construtor
   DoublyCircularList();  // construtor padrão
+  //! Construtor, nós reservados com allocator
+  explicit DoublyCircularList(const Allocator& allocator);
+  //! Construtor de movimento: toma os nós de other
+  DoublyCircularList(DoublyCircularList&& other);
+  //! Atribuição de movimento
+  DoublyCircularList& operator=(DoublyCircularList&& other);
   //! Destrutor
   ~DoublyCircularList();  // destrutor
   //! Limpa a lista
   void clear();  // limpar lista
   //! Insere no fim
   void push_back(const T& data);  // inserir no fim
+  //! Insere no fim, movendo o dado
+  void push_back(T&& data);
   //! Insere no início
   void push_front(const T& data);  // inserir no início
+  //! Insere no início, movendo o dado
+  void push_front(T&& data);
   //! Insere na posição
   void insert(const T& data, std::size_t index);  // inserir na posição
+  //! Insere na posição, movendo o dado
+  void insert(T&& data, std::size_t index);
   //! Insere na ordem
   void insert_sorted(const T& data);  // inserir em ordem
+  //! Insere na ordem, movendo o dado
+  void insert_sorted(T&& data);
+  //! Constrói no fim
+  template<typename... Args>
+  void emplace_back(Args&&... args);
+  //! Constrói no início
+  template<typename... Args>
+  void emplace_front(Args&&... args);
+  //! Constrói na posição
+  template<typename... Args>
+  void emplace(std::size_t index, Args&&... args);
   //! Acessa na posição constante
   T& at(std::size_t index);  // acessar um elemento na posição index
   //! Retira da posição
@@ -42,25 +163,41 @@ class DoublyCircularList {
   std::size_t find(const T& data) const;  // posição do data
   //! Tamanho da lista
   std::size_t size() const;  // tamanho da lista
+  //! Ordena a lista: merge sort estável que religa os nós, sem alocar
+  void sort();
+  //! Move todos os nós de other para antes da posição index
+  void splice(std::size_t index, DoublyCircularList& other);
+  //! Move o nó da posição from de other para antes da posição index
+  void splice(std::size_t index, DoublyCircularList& other,
+              std::size_t from);
+  //! Move os nós [first, last) de other para antes da posição index
+  void splice(std::size_t index, DoublyCircularList& other,
+              std::size_t first, std::size_t last);
+  //! Tira os elementos a partir da posição index para uma nova lista
+  DoublyCircularList split_at(std::size_t index);
+  //! Intercala other nesta lista, as duas em ordem; estável, sem alocar
+  void merge(DoublyCircularList& other);
+  //! Primeiro elemento
+  Iterator begin();
+  //! Depois do último elemento
+  Iterator end();
+  //! Primeiro elemento, só leitura
+  ConstIterator begin() const;
+  //! Depois do último elemento, só leitura
+  ConstIterator end() const;
+  //! Primeiro elemento, só leitura
+  ConstIterator cbegin() const;
+  //! Depois do último elemento, só leitura
+  ConstIterator cend() const;
 
  private:
     //! Classe nó
   class Node {
    public:
-    //! Construtor
-    explicit Node(const T& data):
-      data_{data}
-    {}
-    //! Construtor, próximo parametrizado
-    Node(const T& data, Node* next):
-      data_{data},
-      next_{next}
-    {}
-    //! Construtor parametrizado
-    Node(const T& data, Node* prev, Node* next):
-      data_{data},
-      prev_{prev},
-      next_{next}
+    //! Construtor, dado construído no lugar
+    template<typename... Args>
+    explicit Node(Args&&... args):
+      data_(std::forward<Args>(args)...)
     {}
     //! Dado
     T& data() {
@@ -103,6 +240,30 @@ class DoublyCircularList {
     //! Próximo
     Node* next_{nullptr};
   };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! Reserva e constrói um nó
+  template<typename... Args>
+  Node* create_node(Args&&... args);
+  //! Destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! Nó da posição index, a partir do extremo mais próximo
+  Node* node_at(std::size_t index) const;
+  //! Liga a cadeia first..last antes de position (nullptr: no fim)
+  void link(Node* position, Node* first, Node* last);
+  //! Desliga a cadeia first..last da lista
+  void unlink(Node* first, Node* last);
+  //! Exige que other reserve nós com o mesmo alocador
+  void check_allocator(const DoublyCircularList& other) const;
+  //! Ordena a cadeia chain terminada em nullptr; devolve o primeiro nó
+  static Node* merge_sort(Node* chain);
+  //! Intercala as cadeias ordenadas left e right; iguais de left antes
+  static Node* merge_chains(Node* left, Node* right);
+  //! Reserva os nós
+  NodeAllocator allocator_;
 
   //! Primeiro elemento da lista
   Node* head{nullptr};
@@ -110,53 +271,147 @@ class DoublyCircularList {
   std::size_t size_{0u};
 };
 
-}  // namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! DoublyCircularList com nós em um std::pmr::memory_resource
 template<typename T>
-structures::DoublyCircularList<T>::DoublyCircularList() {
+using DoublyCircularList =
+    structures::DoublyCircularList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList() {
   size_ = 0;
   head = nullptr;
 }
 
-template<typename T>
-structures::DoublyCircularList<T>::~DoublyCircularList() {
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+    const Allocator& allocator):
+  allocator_{allocator}
+{
+  size_ = 0;
+  head = nullptr;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+    DoublyCircularList&& other):
+  allocator_{std::move(other.allocator_)},
+  head{other.head},
+  size_{other.size_}
+{
+  other.head = nullptr;
+  other.size_ = 0;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>&
+structures::DoublyCircularList<T, Allocator>::operator=(
+    DoublyCircularList&& other) {
+  if (this != &other) {
+    clear();
+    if (allocator_ == other.allocator_) {
+      splice(0, other);
+    } else {
+      // nós de outro alocador não podem ser devolvidos por este; o dado
+      // só sai de other depois de inserido, caso reservar o nó falhe
+      while (!other.empty()) {
+        push_back(std::move(other.head->data()));
+        other.pop_front();
+      }
+    }
+  }
+  return *this;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::~DoublyCircularList() {
   clear();
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::clear() {
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::clear() {
   Node* current = head;
   while (size() != 0) {
     auto next = current->next();
-    delete current;
+    destroy_node(current);
     current = next;
     size_--;
   }
   head = nullptr;
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::push_back(const T& data) {
-  Node* element = new Node(data);
-  if (element == nullptr) {
-    throw std::out_of_range("Lista cheia");
-  }
-  if (size() == 0) {
-    element->next(element);
-    element->prev(element);
-    head = element;
-  } else {
-    element->next(head);
-    element->prev(head->prev());
-    head->prev()->next(element);
-    head->prev(element);
-  }
-  size_++;
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::push_front(const T& data) {
-  Node* element = new Node(data);
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert(
+    const T& data, std::size_t index) {
+  emplace(index, data);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert(
+    T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert_sorted(
+    const T& data) {
+	insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert_sorted(T&& data) {
+	if (size() == 0) {
+		return push_front(std::move(data));
+	}
+	auto current = head;
+	auto pos = 0u;
+	while (
+		current->next() != nullptr &&
+		current->next() != head &&
+		data > current->data()
+	) {
+		current = current->next();
+		pos++;
+	}
+	if (data > current->data()) {
+		return insert(std::move(data), pos + 1);
+	} else {
+		return insert(std::move(data), pos);
+	}
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::DoublyCircularList<T, Allocator>::emplace_back(
+    Args&&... args) {
+  Node* element = create_node(std::forward<Args>(args)...);
   if (element == nullptr) {
     throw std::out_of_range("Lista cheia");
   }
@@ -169,25 +424,32 @@ void structures::DoublyCircularList<T>::push_front(const T& data) {
     element->prev(head->prev());
     head->prev()->next(element);
     head->prev(element);
-    head = element;
   }
   size_++;
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::insert(
-	const T& data, std::size_t index
-) {
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::DoublyCircularList<T, Allocator>::emplace_front(
+    Args&&... args) {
+  emplace_back(std::forward<Args>(args)...);
+  head = head->prev();
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::DoublyCircularList<T, Allocator>::emplace(
+    std::size_t index, Args&&... args) {
   if (index > size()) {
     throw std::out_of_range("Índice fora do limite");
   }
   if (index == 0) {
-    return push_front(data);
+    return emplace_front(std::forward<Args>(args)...);
   }
   if (index == size()) {
-    return push_back(data);
+    return emplace_back(std::forward<Args>(args)...);
   }
-  Node* element = new Node(data);
+  Node* element = create_node(std::forward<Args>(args)...);
   if (element == nullptr) {
     throw std::out_of_range("Lista cheia");
   }
@@ -204,30 +466,8 @@ void structures::DoublyCircularList<T>::insert(
   size_++;
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
-	if (size() == 0) {
-		return push_front(data);
-	}
-	auto current = head;
-	auto pos = 0u;
-	while (
-		current->next() != nullptr &&
-		current->next() != head &&
-		data > current->data()
-	) {
-		current = current->next();
-		pos++;
-	}
-	if (data > current->data()) {
-		return insert(data, pos + 1);
-	} else {
-		return insert(data, pos);
-	}
-}
-
-template<typename T>
-T& structures::DoublyCircularList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::DoublyCircularList<T, Allocator>::at(std::size_t index) {
 	if (index > size() - 1) {
 		throw std::out_of_range("Índice fora do limite");
 	}
@@ -238,8 +478,8 @@ T& structures::DoublyCircularList<T>::at(std::size_t index) {
 	return current->data();
 }
 
-template<typename T>
-T structures::DoublyCircularList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
@@ -256,60 +496,60 @@ T structures::DoublyCircularList<T>::pop(std::size_t index) {
   for (auto i = 0u; i < index; i++) {
     current = current->next();
   }
-  auto data = current->data();
+  auto data = std::move(current->data());
   current->next()->prev(current->prev());
   current->prev()->next(current->next());
   size_--;
-  delete current;
+  destroy_node(current);
   return data;
 }
 
-template<typename T>
-T structures::DoublyCircularList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop_back() {
   if (empty()) {
       throw std::out_of_range("Lista vazia");
   }
   if (size() == 1) {
     auto aux = head;
-    auto data = aux->data();
-    delete aux;
+    auto data = std::move(aux->data());
+    destroy_node(aux);
     head = nullptr;
     size_--;
     return data;
   }
   auto current = head->prev();
-  auto data = current->data();
+  auto data = std::move(current->data());
   current->prev()->next(head);
   head->prev(current->prev());
   size_--;
-  delete current;
+  destroy_node(current);
   return data;
 }
 
-template<typename T>
-T structures::DoublyCircularList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop_front() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   if (size() == 1) {
-    auto data = head->data();
-    delete head;
+    auto data = std::move(head->data());
+    destroy_node(head);
     size_--;
     head = nullptr;
     return data;
   }
-  auto data = head->data();
+  auto data = std::move(head->data());
   auto prev_head = head;
   head->next()->prev(head->prev());
   head->prev()->next(head->next());
   head = head->next();
   size_--;
-  delete prev_head;
+  destroy_node(prev_head);
   return data;
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::remove(const T& data) {
   auto current = head;
   for (auto i = 0u; i < size(); i++) {
     if (data == current->data()) {
@@ -320,13 +560,14 @@ void structures::DoublyCircularList<T>::remove(const T& data) {
   }
 }
 
-template<typename T>
-bool structures::DoublyCircularList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::DoublyCircularList<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template<typename T>
-bool structures::DoublyCircularList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::DoublyCircularList<T, Allocator>::contains(
+    const T& data) const {
   auto current = head;
   for (auto i = 0u; i < size(); i++) {
     if (data == current->data()) {
@@ -337,8 +578,9 @@ bool structures::DoublyCircularList<T>::contains(const T& data) const {
   return false;
 }
 
-template<typename T>
-std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyCircularList<T, Allocator>::find(
+    const T& data) const {
   auto current = head;
   for (auto i = 0u; i < size(); i++) {
     if (data == current->data()) {
@@ -349,9 +591,285 @@ std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
   return size();
 }
 
-template<typename T>
-std::size_t structures::DoublyCircularList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyCircularList<T, Allocator>::size() const {
   return size_;
 }
 
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::sort() {
+  if (size() < 2u) {
+    return;
+  }
+  // abre o círculo; a ordenação só religa next, então refaz prev
+  head->prev()->next(nullptr);
+  head = merge_sort(head);
+  auto previous = head;
+  for (auto current = head->next(); current != nullptr;
+       current = current->next()) {
+    current->prev(previous);
+    previous = current;
+  }
+  previous->next(head);
+  head->prev(previous);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::Node*
+structures::DoublyCircularList<T, Allocator>::merge_sort(Node* chain) {
+  // de baixo para cima: bins[k] guarda uma sequência ordenada de 2^k nós
+  // (ou nenhuma); cada nó entra como sequência de um e sobe intercalando,
+  // enquanto as sequências curtas ainda estão em cache
+  Node* bins[std::numeric_limits<std::size_t>::digits] = {};
+  auto used = 0u;
+  while (chain != nullptr) {
+    auto carry = chain;
+    chain = chain->next();
+    carry->next(nullptr);
+    auto k = 0u;
+    for (; k < used && bins[k] != nullptr; k++) {
+      // bins[k] veio antes na lista: fica à esquerda
+      carry = merge_chains(bins[k], carry);
+      bins[k] = nullptr;
+    }
+    if (k == used) {
+      used++;
+    }
+    bins[k] = carry;
+  }
+  Node* sorted = nullptr;
+  for (auto k = 0u; k < used; k++) {
+    sorted = merge_chains(bins[k], sorted);
+  }
+  return sorted;
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::Node*
+structures::DoublyCircularList<T, Allocator>::merge_chains(
+    Node* left, Node* right) {
+  if (left == nullptr) {
+    return right;
+  }
+  if (right == nullptr) {
+    return left;
+  }
+  Node* first = nullptr;
+  Node* last = nullptr;
+  while (left != nullptr && right != nullptr) {
+    Node* next;
+    if (left->data() > right->data()) {
+      next = right;
+      right = right->next();
+    } else {
+      next = left;
+      left = left->next();
+    }
+    if (last == nullptr) {
+      first = next;
+    } else {
+      last->next(next);
+    }
+    last = next;
+  }
+  last->next(left != nullptr ? left : right);
+  return first;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::splice(
+    std::size_t index, DoublyCircularList& other) {
+  splice(index, other, 0, other.size());
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::splice(
+    std::size_t index, DoublyCircularList& other, std::size_t from) {
+  splice(index, other, from, from + 1);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::splice(
+    std::size_t index, DoublyCircularList& other, std::size_t first,
+    std::size_t last) {
+  check_allocator(other);
+  if (index > size() || first > last || last > other.size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  if (&other == this && index >= first && index <= last) {
+    if (index > first && index < last) {
+      throw std::out_of_range("Índice dentro do intervalo movido");
+    }
+    return;  // o intervalo já está na posição
+  }
+  if (first == last) {
+    return;
+  }
+  // localiza tudo antes de mudar as posições
+  auto position = index == size() ? nullptr : node_at(index);
+  auto first_node = other.node_at(first);
+  auto last_node = other.node_at(last - 1);
+  other.unlink(first_node, last_node);
+  other.size_ -= last - first;
+  link(position, first_node, last_node);
+  size_ += last - first;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>
+structures::DoublyCircularList<T, Allocator>::split_at(std::size_t index) {
+  if (index > size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  DoublyCircularList rest{Allocator(allocator_)};
+  rest.splice(0, *this, index, size());
+  return rest;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::merge(
+    DoublyCircularList& other) {
+  if (&other == this) {
+    return;
+  }
+  check_allocator(other);
+  auto current = head;
+  auto remaining = size();  // nós desta lista ainda à frente de current
+  while (!other.empty()) {
+    if (remaining == 0) {
+      // o resto de other é maior que todos desta lista
+      splice(size(), other);
+      break;
+    }
+    if (current->data() > other.head->data()) {
+      // iguais ficam depois dos desta lista: merge estável
+      auto node = other.head;
+      other.unlink(node, node);
+      other.size_--;
+      link(current, node, node);
+      size_++;
+    } else {
+      current = current->next();
+      remaining--;
+    }
+  }
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::Node*
+structures::DoublyCircularList<T, Allocator>::node_at(
+    std::size_t index) const {
+  auto current = head;
+  if (index <= size() / 2) {
+    for (auto i = 0u; i < index; i++) {
+      current = current->next();
+    }
+  } else {
+    for (auto i = size(); i > index; i--) {
+      current = current->prev();
+    }
+  }
+  return current;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::link(
+    Node* position, Node* first, Node* last) {
+  if (head == nullptr) {
+    first->prev(last);
+    last->next(first);
+    head = first;
+    return;
+  }
+  auto next = position == nullptr ? head : position;
+  auto previous = next->prev();
+  previous->next(first);
+  first->prev(previous);
+  last->next(next);
+  next->prev(last);
+  if (position == head) {
+    head = first;
+  }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::unlink(
+    Node* first, Node* last) {
+  if (first == head && last->next() == head) {
+    head = nullptr;
+    return;
+  }
+  auto previous = first->prev();
+  auto next = last->next();
+  previous->next(next);
+  next->prev(previous);
+  if (first == head) {
+    head = next;
+  }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::check_allocator(
+    const DoublyCircularList& other) const {
+  if (!(allocator_ == other.allocator_)) {
+    throw std::invalid_argument("Listas com alocadores diferentes");
+  }
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::Iterator
+structures::DoublyCircularList<T, Allocator>::begin() {
+  return Iterator(head, 0u);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::Iterator
+structures::DoublyCircularList<T, Allocator>::end() {
+  return Iterator(head, size());
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::ConstIterator
+structures::DoublyCircularList<T, Allocator>::begin() const {
+  return ConstIterator(head, 0u);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::ConstIterator
+structures::DoublyCircularList<T, Allocator>::end() const {
+  return ConstIterator(head, size());
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::ConstIterator
+structures::DoublyCircularList<T, Allocator>::cbegin() const {
+  return begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::ConstIterator
+structures::DoublyCircularList<T, Allocator>::cend() const {
+  return end();
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::DoublyCircularList<T, Allocator>::Node*
+structures::DoublyCircularList<T, Allocator>::create_node(Args&&... args) {
+  auto node = NodeTraits::allocate(allocator_, 1);
+  try {
+    NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
 #endif
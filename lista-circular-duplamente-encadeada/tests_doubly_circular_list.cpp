@@ -1,6 +1,18 @@
 // Copyright 2016 João Paulo Taylor Ienczak Zanette
 #include "gtest/gtest.h"
 #include "doubly_circular_list.h"
+#include "../lista-encadeada/node_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -214,3 +226,349 @@ TEST_F(DoublyCircularListTest, RemoveElement) {
     ASSERT_EQ(9u, list.size());
     ASSERT_FALSE(list.contains(4));
 }
+
+TEST(DoublyCircularListMoveTest, SplitAndMergeRelinkNodes) {
+    // split_at e merge só religam os nós, inclusive a ligação do último
+    // com o primeiro: cada string fica no nó em que foi construída
+    structures::DoublyCircularList<std::string> list{};
+    structures::DoublyCircularList<std::string> other{};
+    const std::string* address[11];
+    for (auto c : {'a', 'c', 'e', 'g', 'i', 'k'}) {
+        list.emplace_back(1u, c);
+        address[c - 'a'] = &list.at(list.size() - 1);
+    }
+    for (auto c : {'b', 'd', 'f'}) {
+        other.emplace_back(1u, c);
+        address[c - 'a'] = &other.at(other.size() - 1);
+    }
+    auto rest = list.split_at(3u);
+    list.merge(other);
+    list.merge(rest);
+    auto expected = std::string("abcdefgik");
+    ASSERT_EQ(expected.size(), list.size());
+    for (auto i = 0u; i < expected.size(); ++i) {
+        ASSERT_EQ(address[expected[i] - 'a'], &list.at(i));
+    }
+    ASSERT_EQ("k", list.pop_back());
+    ASSERT_EQ("a", list.pop_front());
+}
+
+TEST(DoublyCircularListMoveTest, MoveOutAfterWrap) {
+    // head dá voltas no anel; depois, retiradas pelas duas pontas e pelo
+    // meio cruzam a ligação do último nó com o primeiro
+    structures::DoublyCircularList<std::unique_ptr<int>> list{};
+    for (auto i = 0; i < 4; ++i) {
+        list.emplace_back(new int(i));
+    }
+    for (auto i = 4; i < 10; ++i) {
+        ASSERT_EQ(i - 4, *list.pop_front());
+        list.emplace_back(new int(i));
+    }
+    list.emplace_front(new int(5));
+    ASSERT_EQ(9, *list.pop_back());
+    ASSERT_EQ(5, *list.pop_front());
+    ASSERT_EQ(7, *list.pop(1u));
+    list.emplace(1u, new int(10));
+    auto expected = std::vector<int>{6, 10, 8};
+    auto i = 0u;
+    for (const auto& data : list) {
+        ASSERT_EQ(expected[i++], *data);
+    }
+    ASSERT_EQ(3u, i);
+    ASSERT_EQ(8, *list.pop_back());
+    ASSERT_EQ(6, *list.pop_front());
+    ASSERT_EQ(10, *list.pop_back());
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(DoublyCircularListPoolTest, MoveConstructTakesPoolNodes) {
+    // o construtor de movimento toma o anel sem reservar nada: quem
+    // devolve os blocos ao pool é a lista nova
+    structures::NodePool pool;
+    using PoolList = structures::DoublyCircularList<int,
+        structures::PoolAllocator<int>>;
+    PoolList list{structures::PoolAllocator<int>{pool}};
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    {
+        PoolList moved{std::move(list)};
+        ASSERT_EQ(10u, pool.used());
+        ASSERT_TRUE(list.empty());
+        ASSERT_EQ(9, moved.at(9));
+        list.push_back(10);
+        ASSERT_EQ(11u, pool.used());
+    }
+    ASSERT_EQ(1u, pool.used());
+    ASSERT_EQ(10, list.pop_back());
+    ASSERT_EQ(0u, pool.used());
+}
+
+#if __cplusplus >= 201703L
+TEST(DoublyCircularListPmrTest, MoveAssignIntoExhaustedResource) {
+    // recursos diferentes: cada elemento ganha um nó novo no destino, e o
+    // que não coube continua em source, sem ser movido
+    alignas(std::max_align_t) char buffer[1 << 9];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::DoublyCircularList<std::string> target{&resource};
+    structures::pmr::DoublyCircularList<std::string> source{};
+    for (auto i = 0; i < 100; i++) {
+        source.push_back(std::string(32, 'a') + std::to_string(i));
+    }
+    ASSERT_THROW(target = std::move(source), std::bad_alloc);
+    ASSERT_GT(target.size(), 0u);
+    ASSERT_EQ(100u, target.size() + source.size());
+    auto i = 0;
+    for (const auto& data : target) {
+        ASSERT_EQ(std::string(32, 'a') + std::to_string(i++), data);
+    }
+    for (const auto& data : source) {
+        ASSERT_EQ(std::string(32, 'a') + std::to_string(i++), data);
+    }
+}
+#endif
+
+TEST_F(DoublyCircularListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto& data : list) {
+        ASSERT_EQ(expected++, data);
+        data *= 2;
+    }
+    ASSERT_EQ(10, expected);
+    const auto& const_list = list;
+    auto sum = 0;
+    for (auto data : const_list) {
+        sum += data;
+    }
+    ASSERT_EQ(90, sum);
+    ASSERT_EQ(10, std::distance(list.begin(), list.end()));
+    auto it = std::find(list.begin(), list.end(), 8);
+    ASSERT_EQ(8, *it);
+    structures::DoublyCircularList<int>::ConstIterator converted = it;
+    ASSERT_EQ(10, *++converted);
+    ASSERT_TRUE(std::find(list.begin(), list.end(), 7) == list.end());
+}
+
+TEST_F(DoublyCircularListTest, IteratorsAfterChanges) {
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+    }
+    list.pop_back();
+    list.push_front(-1);
+    list.insert(10, 2);
+    std::vector<int> contents(list.begin(), list.end());
+    ASSERT_EQ((std::vector<int>{-1, 0, 10, 1, 2, 3}), contents);
+    while (!list.empty()) {
+        list.pop_front();
+    }
+    ASSERT_TRUE(list.begin() == list.end());
+}
+
+TEST_F(DoublyCircularListTest, BidirectionalIterators) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(9, *--list.end());
+    std::reverse(list.begin(), list.end());
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(9 - static_cast<int>(i), list.at(i));
+    }
+    auto it = list.end();
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, *--it);
+    }
+    ASSERT_TRUE(it == list.begin());
+}
+
+namespace {
+// chave comparada pelo merge; tag só distingue iguais
+struct Keyed {
+    int key;
+    int tag;
+    bool operator>(const Keyed& other) const { return key > other.key; }
+};
+
+template<typename List>
+std::vector<int> contents(const List& container) {
+    return std::vector<int>(container.begin(), container.end());
+}
+}  // namespace
+
+TEST_F(DoublyCircularListTest, SpliceWholeList) {
+    structures::DoublyCircularList<int> other;
+    for (auto i = 0; i < 3; ++i) {
+        list.push_back(i);
+        other.push_back(10 + i);
+    }
+    list.splice(1u, other);
+    ASSERT_EQ((std::vector<int>{0, 10, 11, 12, 1, 2}), contents(list));
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(6u, list.size());
+    list.splice(0u, other);  // lista vazia: nada muda
+    ASSERT_EQ(6u, list.size());
+    other.splice(0u, list);
+    ASSERT_EQ((std::vector<int>{0, 10, 11, 12, 1, 2}), contents(other));
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(2, other.pop_back());
+    ASSERT_EQ(0, other.pop_front());
+}
+
+TEST_F(DoublyCircularListTest, SpliceElementAndRange) {
+    structures::DoublyCircularList<int> other;
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+        other.push_back(10 + i);
+    }
+    list.splice(5u, other, 0u);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 10}), contents(list));
+    ASSERT_EQ((std::vector<int>{11, 12, 13, 14}), contents(other));
+    list.splice(0u, other, 1u, 3u);
+    ASSERT_EQ((std::vector<int>{12, 13, 0, 1, 2, 3, 4, 10}), contents(list));
+    ASSERT_EQ((std::vector<int>{11, 14}), contents(other));
+    ASSERT_EQ(8u, list.size());
+    ASSERT_EQ(2u, other.size());
+    ASSERT_EQ(10, list.at(7));
+    ASSERT_EQ(14, other.at(1));
+    ASSERT_THROW(list.splice(9u, other, 0u), std::out_of_range);
+    ASSERT_THROW(list.splice(0u, other, 2u), std::out_of_range);
+    ASSERT_THROW(list.splice(0u, other, 1u, 0u), std::out_of_range);
+}
+
+TEST_F(DoublyCircularListTest, SpliceWithinList) {
+    for (auto i = 0; i < 6; ++i) {
+        list.push_back(i);
+    }
+    list.splice(0u, list, 4u, 6u);
+    ASSERT_EQ((std::vector<int>{4, 5, 0, 1, 2, 3}), contents(list));
+    list.splice(6u, list, 0u);
+    ASSERT_EQ((std::vector<int>{5, 0, 1, 2, 3, 4}), contents(list));
+    list.splice(2u, list, 2u, 4u);  // já está no lugar
+    ASSERT_EQ((std::vector<int>{5, 0, 1, 2, 3, 4}), contents(list));
+    ASSERT_THROW(list.splice(3u, list, 2u, 4u), std::out_of_range);
+    ASSERT_EQ(6u, list.size());
+}
+
+TEST_F(DoublyCircularListTest, SplitAt) {
+    for (auto i = 0; i < 6; ++i) {
+        list.push_back(i);
+    }
+    auto rest = list.split_at(4u);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), contents(list));
+    ASSERT_EQ((std::vector<int>{4, 5}), contents(rest));
+    auto all = list.split_at(0u);
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(4u, all.size());
+    auto none = all.split_at(4u);
+    ASSERT_TRUE(none.empty());
+    ASSERT_THROW(all.split_at(5u), std::out_of_range);
+    list = std::move(all);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), contents(list));
+    ASSERT_TRUE(all.empty());
+}
+
+TEST_F(DoublyCircularListTest, MergeIsStable) {
+    structures::DoublyCircularList<Keyed> first;
+    structures::DoublyCircularList<Keyed> second;
+    for (auto key : {1, 3, 3, 5, 7}) {
+        first.push_back(Keyed{key, 0});
+    }
+    for (auto key : {0, 3, 4, 7, 8, 9}) {
+        second.push_back(Keyed{key, 1});
+    }
+    first.merge(second);
+    ASSERT_TRUE(second.empty());
+    ASSERT_EQ(11u, first.size());
+    std::vector<int> keys;
+    for (const auto& data : first) {
+        keys.push_back(data.key);
+    }
+    ASSERT_EQ((std::vector<int>{0, 1, 3, 3, 3, 4, 5, 7, 7, 8, 9}), keys);
+    // entre iguais, os desta lista vêm antes dos de other
+    ASSERT_EQ(0, first.at(2).tag);
+    ASSERT_EQ(0, first.at(3).tag);
+    ASSERT_EQ(1, first.at(4).tag);
+    ASSERT_EQ(0, first.at(7).tag);
+    ASSERT_EQ(1, first.at(8).tag);
+    ASSERT_EQ(9, first.pop_back().key);
+    ASSERT_EQ(0, first.pop_front().key);
+
+    structures::DoublyCircularList<Keyed> empty;
+    empty.merge(first);
+    ASSERT_EQ(9u, empty.size());
+    ASSERT_TRUE(first.empty());
+}
+
+TEST(DoublyCircularListPoolTest, SpliceRequiresSameAllocator) {
+    structures::NodePool pool;
+    structures::NodePool other_pool;
+    using PoolList = structures::DoublyCircularList<int,
+        structures::PoolAllocator<int>>;
+    PoolList a{structures::PoolAllocator<int>{pool}};
+    PoolList b{structures::PoolAllocator<int>{pool}};
+    PoolList c{structures::PoolAllocator<int>{other_pool}};
+    for (auto i = 0; i < 4; ++i) {
+        a.push_back(i);
+        c.push_back(i);
+    }
+    b.splice(0u, a, 1u, 3u);
+    ASSERT_EQ(2u, b.size());
+    ASSERT_THROW(b.splice(0u, c), std::invalid_argument);
+    ASSERT_THROW(b.merge(c), std::invalid_argument);
+    b = std::move(c);  // alocadores diferentes: move elemento a elemento
+    ASSERT_EQ(4u, b.size());
+    ASSERT_TRUE(c.empty());
+    ASSERT_EQ(0u, other_pool.used());
+    ASSERT_EQ(6u, pool.used());
+}
+
+TEST_F(DoublyCircularListTest, SortMatchesReference) {
+    list.sort();
+    ASSERT_TRUE(list.empty());
+    list.push_back(1);
+    list.sort();
+    ASSERT_EQ(1, list.at(0));
+    list.clear();
+    std::srand(11);
+    for (auto n : {2, 3, 7, 64, 100, 1000}) {
+        std::vector<int> reference;
+        for (auto i = 0; i < n; ++i) {
+            reference.push_back(std::rand() % 50);
+            list.push_back(reference.back());
+        }
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        ASSERT_EQ(reference.size(), list.size());
+        ASSERT_TRUE(std::equal(reference.begin(), reference.end(),
+                               list.begin()));
+        // extremos e ligações continuam válidos depois de religar os nós
+        list.push_back(100);
+        list.push_front(-1);
+        ASSERT_EQ(100, list.pop_back());
+        ASSERT_EQ(-1, list.pop_front());
+        ASSERT_EQ(reference.back(), list.pop_back());
+        ASSERT_EQ(reference.front(), list.at(0));
+        list.clear();
+    }
+}
+
+TEST_F(DoublyCircularListTest, SortIsStable) {
+    structures::DoublyCircularList<Keyed> keyed;
+    for (auto i = 0; i < 200; ++i) {
+        keyed.push_back(Keyed{(i * 7) % 5, i});
+    }
+    keyed.sort();
+    auto previous = Keyed{-1, -1};
+    for (const auto& data : keyed) {
+        ASSERT_FALSE(previous > data);
+        if (previous.key == data.key) {
+            ASSERT_GT(data.tag, previous.tag);
+        }
+        previous = data;
+    }
+    ASSERT_EQ(200u, keyed.size());
+}
@@ -0,0 +1,100 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Vazão de ConcurrentSkipList contra std::set com mutex, de 1 a N threads.
+// Compilar: g++ -O2 -std=c++14 -pthread bench_concurrent_skip_list.cpp
+//           -o bench_concurrent_skip_list
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "concurrent_skip_list.h"
+
+const unsigned KEYS = 1u << 20;
+const unsigned OPERATIONS = 1000000u;  // por thread
+
+//! Adaptador de std::set protegido por um mutex
+class LockedSet {
+ public:
+  bool insert_sorted(unsigned data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return set_.insert(data).second;
+  }
+  bool remove(unsigned data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return set_.erase(data) != 0;
+  }
+  bool contains(unsigned data) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return set_.count(data) != 0;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::set<unsigned> set_;
+};
+
+//! Soma dos resultados, para que nenhuma busca seja descartada
+std::atomic<unsigned> checksum{0u};
+
+//! Milhões de operações por segundo com threads threads; lookups em %
+template<typename Set>
+double run(Set& set, unsigned threads, unsigned lookups) {
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (auto thread = 0u; thread < threads; thread++) {
+    workers.emplace_back([&set, thread, lookups] {
+      auto seed = 0x9e3779b9u * (thread + 1);
+      auto hits = 0u;
+      for (auto i = 0u; i < OPERATIONS; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        auto key = seed % KEYS;
+        auto operation = (seed >> 20) % 100;
+        if (operation < lookups) {
+          hits += set.contains(key);
+        } else if (operation % 2 == 0) {
+          hits += set.insert_sorted(key);
+        } else {
+          hits += set.remove(key);
+        }
+      }
+      checksum += hits;
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto seconds = std::chrono::duration<double>(end - start).count();
+  return threads * OPERATIONS / seconds / 1e6;
+}
+
+//! Tabela de vazão para uma proporção de buscas
+void table(unsigned lookups, unsigned max_threads) {
+  std::printf("%u%% contains, %u%% insert_sorted/remove (Mops/s)\n", lookups,
+              100 - lookups);
+  for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+    structures::ConcurrentSkipList<unsigned> skip_list;
+    LockedSet locked_set;
+    for (auto key = 0u; key < KEYS; key += 2) {
+      skip_list.insert_sorted(key);
+      locked_set.insert_sorted(key);
+    }
+    std::printf("  %2u threads  ConcurrentSkipList %7.2f  std::set+mutex"
+                " %7.2f\n", threads, run(skip_list, threads, lookups),
+                run(locked_set, threads, lookups));
+  }
+}
+
+int main() {
+  auto max_threads = std::max(4u, std::thread::hardware_concurrency());
+  std::printf("%u chaves, %u operações por thread\n", KEYS, OPERATIONS);
+  table(90, max_threads);
+  table(50, max_threads);
+  std::printf("(%u)\n", checksum.load());
+  return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de SkipList contra as listas ordenadas e std::multiset.
+// Compilar: g++ -O2 -std=c++14 bench_skip_list.cpp -o bench_skip_list
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include "skip_list.h"
+#include "../lista-encadeada/linked_list.h"
+#include "../lista-vetor-ordenada/sorted_array_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+const unsigned OPERATIONS = 100000u;
+
+//! Adaptador de std::multiset para a interface das listas ordenadas
+class MultiSet {
+ public:
+  void insert_sorted(int data) { set_.insert(data); }
+  bool contains(int data) const { return set_.count(data) != 0; }
+  void remove(int data) {
+    auto it = set_.find(data);
+    if (it != set_.end()) {
+      set_.erase(it);
+    }
+  }
+
+ private:
+  std::multiset<int> set_;
+};
+
+//! Tempos (ms) de n inserções aleatórias e das buscas e retiradas
+template<typename List>
+void run(const char* name, List& list, unsigned n) {
+  long long checksum = 0;
+  std::srand(42);
+  auto insert = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      list.insert_sorted(std::rand() % (2 * n));
+    }
+  });
+  auto contains = measure([&] {
+    for (auto i = 0u; i < OPERATIONS; i++) {
+      checksum += list.contains(std::rand() % (2 * n));
+    }
+  });
+  auto remove = measure([&] {
+    for (auto i = 0u; i < OPERATIONS; i++) {
+      // SortedArrayList::remove exige que o dado exista
+      auto data = static_cast<int>(std::rand() % (2 * n));
+      if (list.contains(data)) {
+        list.remove(data);
+      }
+    }
+  });
+  std::printf("  %-16s insert_sorted %10.2f  contains %8.2f  remove %8.2f"
+              "  (%lld)\n", name, insert, contains, remove, checksum);
+}
+
+int main() {
+  std::printf("n inserções e %u buscas/retiradas, tempos em ms\n",
+              OPERATIONS);
+  for (auto n : {10000u, 100000u, 1000000u}) {
+    std::printf("n=%u\n", n);
+    if (n <= 10000u) {
+      structures::LinkedList<int> list;
+      run("LinkedList", list, n);
+    }
+    if (n <= 100000u) {
+      structures::SortedArrayList<int> list(n);
+      run("SortedArrayList", list, n);
+    }
+    {
+      structures::SkipList<int> list;
+      run("SkipList", list, n);
+    }
+    {
+      MultiSet list;
+      run("std::multiset", list, n);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,643 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_CONCURRENT_SKIP_LIST_H
+#define STRUCTURES_CONCURRENT_SKIP_LIST_H
+
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <cstdint>
+#include <functional>  // std::hash
+#include <memory>  // std::allocator, std::allocator_traits
+#include <new>  // placement new
+#include <thread>  // std::this_thread
+#include <utility>  // std::move, std::forward
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+namespace structures {
+
+template<typename T, typename Allocator = std::allocator<T>>
+//! Conjunto ordenado sem travas (lock-free), compartilhado entre threads
+/*!
+  Lista com saltos em que inserções e remoções usam compare-and-swap.
+  remove primeiro marca as ligações do nó (bit menos significativo do
+  ponteiro) e só então o desliga; quem encontra um nó marcado no caminho
+  ajuda a desligá-lo. Os nós retirados só voltam ao alocador quando
+  nenhuma thread pode mais estar lendo-os (reclamação por épocas).
+  Não guarda repetidos e a comparação usa só operator> e operator==.
+  O alocador precisa aceitar chamadas concorrentes (std::allocator,
+  SharedPoolAllocator, std::pmr::synchronized_pool_resource...). Cada nó
+  é um único objeto do alocador, do tipo da sua classe de altura (1, 2,
+  4... MAX_HEIGHT ligações), então SharedPoolAllocator tira todos os nós
+  dos pools por tamanho.
+*/
+class ConcurrentSkipList {
+ public:
+  //! construtor
+  ConcurrentSkipList();
+  //! construtor, nós reservados com allocator
+  explicit ConcurrentSkipList(const Allocator& allocator);
+  //! não copiável
+  ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+  //! não copiável
+  ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+  //! destrutor (sem outras threads usando a lista)
+  ~ConcurrentSkipList();
+  //! insere na ordem; false se já havia um igual
+  bool insert_sorted(const T& data);
+  //! insere na ordem, movendo o dado; false se já havia um igual
+  bool insert_sorted(T&& data);
+  //! retira específico; false se não havia
+  bool remove(const T& data);
+  //! verifica se contém (só leitura, não espera outras threads)
+  bool contains(const T& data) const;
+  //! verifica lista vazia
+  bool empty() const;
+  //! tamanho da lista (aproximado durante escritas concorrentes)
+  std::size_t size() const;
+
+ private:
+  //! ligação de um nível: endereço do próximo nó | MARK
+  using Link = std::atomic<std::uintptr_t>;
+  //! nó: dado e altura; as height ligações vêm logo depois do nó
+  struct Node {
+    //! construtor, dado construído no lugar
+    template<typename... Args>
+    explicit Node(std::size_t height, Args&&... args):
+      data(std::forward<Args>(args)...),
+      height{height}
+    {}
+    //! ligações do nó
+    Link* links() {
+      return reinterpret_cast<Link*>(this + 1);
+    }
+    //! ligações do nó
+    const Link* links() const {
+      return reinterpret_cast<const Link*>(this + 1);
+    }
+    //! dado
+    T data;
+    //! quantidade de ligações
+    std::size_t height;
+  };
+  //! Registro de época, usado por uma thread de cada vez
+  struct Record {
+    //! em uso por alguma thread
+    std::atomic<bool> busy{false};
+    //! (época observada << 1) | 1 durante uma operação, 0 fora dela
+    std::atomic<std::uint64_t> epoch{0u};
+    //! época em que retired[epoch % 3] foi liberada pela última vez
+    std::uint64_t collected{0u};
+    //! nós retirados em cada época, módulo 3
+    std::vector<Node*> retired[3];
+    //! próximo registro
+    Record* next{nullptr};
+  };
+  //! Operação em andamento: os nós lidos não são liberados até o fim
+  class Guard {
+   public:
+    //! entra na época atual
+    explicit Guard(const ConcurrentSkipList& list);
+    //! não copiável
+    Guard(const Guard&) = delete;
+    //! não copiável
+    Guard& operator=(const Guard&) = delete;
+    //! sai da época
+    ~Guard();
+    //! registro da thread
+    Record* record() const;
+
+   private:
+    //! lista protegida
+    const ConcurrentSkipList& list_;
+    //! registro da thread
+    Record* record_;
+  };
+  //! Bloco de um nó com até Links ligações (uma classe de altura)
+  template<std::size_t Links>
+  struct alignas(Node) Tower {
+    //! o nó seguido das ligações
+    unsigned char bytes[sizeof(Node) + Links * sizeof(Link)];
+  };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! bit de remoção lógica nas ligações
+  static const std::uintptr_t MARK = 1u;
+  //! nó de uma ligação
+  static Node* pointer(std::uintptr_t link);
+  //! verifica se a ligação é de um nó retirado
+  static bool marked(std::uintptr_t link);
+  //! ligação para node
+  static std::uintptr_t link_to(const Node* node);
+  //! identificador único da lista
+  static std::uint64_t next_id();
+  //! reserva e constrói um nó com height ligações
+  template<typename... Args>
+  Node* create_node(std::size_t height, Args&&... args);
+  //! destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! reserva o bloco da classe de altura de um nó com height ligações
+  Node* allocate_node(std::size_t height);
+  //! devolve o bloco de um nó com height ligações
+  void deallocate_node(Node* node, std::size_t height);
+  //! classe de altura: menor potência de 2 que comporta height ligações
+  static std::size_t tower_links(std::size_t height);
+  //! reserva um Tower<Links>
+  template<std::size_t Links>
+  Node* allocate_tower();
+  //! devolve um Tower<Links>
+  template<std::size_t Links>
+  void deallocate_tower(Node* node);
+  //! altura aleatória: nível i + 1 com probabilidade 1/4 do nível i
+  static std::size_t random_height();
+  //! ligações antes do primeiro não menor que data e os nós seguintes
+  bool search(const T& data, Link** preds, Node** succs);
+  //! uma tentativa de search; false se outra thread mudou o caminho
+  bool try_search(const T& data, Link** preds, Node** succs);
+  //! liga node na ordem; false se já havia um igual
+  bool insert(Node* node);
+  //! liga node no nível level; false se remove já marcou o nó
+  bool link_level(Node* node, std::size_t level, Link** preds,
+                  Node** succs);
+  //! registro livre para a thread atual, marcado como ativo
+  Record* enter() const;
+  //! libera o registro
+  void leave(Record* record) const;
+  //! libera node quando nenhuma operação em andamento puder vê-lo
+  void retire(Record* record, Node* node);
+  //! avança a época se todas as operações ativas estão na atual
+  void try_advance();
+  //! altura máxima das torres (a maior classe de altura)
+  static const std::size_t MAX_HEIGHT = 32u;
+  static_assert((MAX_HEIGHT & (MAX_HEIGHT - 1)) == 0,
+                "MAX_HEIGHT precisa ser potência de 2");
+  //! retiradas entre tentativas de avançar a época
+  static const std::size_t RETIRE_BATCH = 64u;
+  //! reserva os nós
+  NodeAllocator allocator_;
+  //! ligações da cabeça, uma por nível
+  Link head_[MAX_HEIGHT];
+  //! níveis em uso (só cresce)
+  std::atomic<std::size_t> height_{1u};
+  //! tamanho da lista
+  std::atomic<std::size_t> size_{0u};
+  //! época global
+  std::atomic<std::uint64_t> epoch_{1u};
+  //! registros de época (nunca removidos antes do destrutor)
+  mutable std::atomic<Record*> records_{nullptr};
+  //! identifica a lista no cache de registro de cada thread
+  const std::uint64_t id_{next_id()};
+};
+
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! ConcurrentSkipList com nós em um std::pmr::memory_resource sincronizado
+template<typename T>
+using ConcurrentSkipList =
+    structures::ConcurrentSkipList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::ConcurrentSkipList<T, Allocator>::ConcurrentSkipList() {
+  for (auto& link : head_) {
+    link.store(0u, std::memory_order_relaxed);
+  }
+}
+
+template<typename T, typename Allocator>
+structures::ConcurrentSkipList<T, Allocator>::ConcurrentSkipList(
+    const Allocator& allocator):
+  allocator_{allocator}
+{
+  for (auto& link : head_) {
+    link.store(0u, std::memory_order_relaxed);
+  }
+}
+
+template<typename T, typename Allocator>
+structures::ConcurrentSkipList<T, Allocator>::~ConcurrentSkipList() {
+  // sem operações em andamento, os nós marcados já foram desligados
+  auto current = pointer(head_[0].load(std::memory_order_acquire));
+  while (current != nullptr) {
+    auto next = pointer(current->links()[0].load(std::memory_order_relaxed));
+    destroy_node(current);
+    current = next;
+  }
+  auto record = records_.load(std::memory_order_acquire);
+  while (record != nullptr) {
+    for (auto& retired : record->retired) {
+      for (auto node : retired) {
+        destroy_node(node);
+      }
+    }
+    auto next = record->next;
+    delete record;
+    record = next;
+  }
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::insert_sorted(
+    const T& data) {
+  return insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::insert_sorted(T&& data) {
+  auto node = create_node(random_height(), std::move(data));
+  if (!insert(node)) {
+    destroy_node(node);
+    return false;
+  }
+  return true;
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::remove(const T& data) {
+  Guard guard{*this};
+  Link* preds[MAX_HEIGHT]{};
+  Node* succs[MAX_HEIGHT]{};
+  if (!search(data, preds, succs)) {
+    return false;
+  }
+  auto node = succs[0];
+  // marca de cima para baixo; quem marca o nível 0 retira o nó
+  for (auto level = node->height; level-- > 1;) {
+    auto link = node->links()[level].load(std::memory_order_relaxed);
+    while (!marked(link) &&
+           !node->links()[level].compare_exchange_weak(link, link | MARK)) {
+    }
+  }
+  auto link = node->links()[0].load(std::memory_order_relaxed);
+  do {
+    if (marked(link)) {
+      return false;
+    }
+  } while (!node->links()[0].compare_exchange_weak(link, link | MARK));
+  size_.fetch_sub(1u, std::memory_order_relaxed);
+  // desliga o nó de todos os níveis antes de entregá-lo
+  search(data, preds, succs);
+  retire(guard.record(), node);
+  return true;
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::contains(
+    const T& data) const {
+  Guard guard{*this};
+  const Link* links = head_;
+  const Node* current = nullptr;
+  for (auto level = height_.load(std::memory_order_acquire); level-- > 0;) {
+    current = pointer(links[level].load(std::memory_order_acquire));
+    while (current != nullptr) {
+      auto next = current->links()[level].load(std::memory_order_acquire);
+      if (marked(next)) {
+        current = pointer(next);
+      } else if (data > current->data) {
+        links = current->links();
+        current = pointer(next);
+      } else {
+        break;
+      }
+    }
+  }
+  return current != nullptr && current->data == data;
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::empty() const {
+  return size() == 0;
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ConcurrentSkipList<T, Allocator>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+template<typename T, typename Allocator>
+structures::ConcurrentSkipList<T, Allocator>::Guard::Guard(
+    const ConcurrentSkipList& list):
+  list_{list},
+  record_{list.enter()}
+{}
+
+template<typename T, typename Allocator>
+structures::ConcurrentSkipList<T, Allocator>::Guard::~Guard() {
+  list_.leave(record_);
+}
+
+template<typename T, typename Allocator>
+typename structures::ConcurrentSkipList<T, Allocator>::Record*
+structures::ConcurrentSkipList<T, Allocator>::Guard::record() const {
+  return record_;
+}
+
+template<typename T, typename Allocator>
+typename structures::ConcurrentSkipList<T, Allocator>::Node*
+structures::ConcurrentSkipList<T, Allocator>::pointer(std::uintptr_t link) {
+  return reinterpret_cast<Node*>(link & ~MARK);
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::marked(
+    std::uintptr_t link) {
+  return (link & MARK) != 0;
+}
+
+template<typename T, typename Allocator>
+std::uintptr_t structures::ConcurrentSkipList<T, Allocator>::link_to(
+    const Node* node) {
+  return reinterpret_cast<std::uintptr_t>(node);
+}
+
+template<typename T, typename Allocator>
+std::uint64_t structures::ConcurrentSkipList<T, Allocator>::next_id() {
+  static std::atomic<std::uint64_t> last{0u};
+  return last.fetch_add(1u, std::memory_order_relaxed) + 1;
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::ConcurrentSkipList<T, Allocator>::Node*
+structures::ConcurrentSkipList<T, Allocator>::create_node(
+    std::size_t height, Args&&... args) {
+  auto node = allocate_node(height);
+  try {
+    NodeTraits::construct(allocator_, node, height,
+                          std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate_node(node, height);
+    throw;
+  }
+  for (auto level = 0u; level < height; level++) {
+    new (&node->links()[level]) Link{0u};
+  }
+  return node;
+}
+
+template<typename T, typename Allocator>
+void structures::ConcurrentSkipList<T, Allocator>::destroy_node(Node* node) {
+  auto height = node->height;
+  NodeTraits::destroy(allocator_, node);
+  deallocate_node(node, height);
+}
+
+template<typename T, typename Allocator>
+typename structures::ConcurrentSkipList<T, Allocator>::Node*
+structures::ConcurrentSkipList<T, Allocator>::allocate_node(
+    std::size_t height) {
+  switch (tower_links(height)) {
+  case 1u:
+    return allocate_tower<1u>();
+  case 2u:
+    return allocate_tower<2u>();
+  case 4u:
+    return allocate_tower<4u>();
+  case 8u:
+    return allocate_tower<8u>();
+  case 16u:
+    return allocate_tower<16u>();
+  default:
+    return allocate_tower<MAX_HEIGHT>();
+  }
+}
+
+template<typename T, typename Allocator>
+void structures::ConcurrentSkipList<T, Allocator>::deallocate_node(
+    Node* node, std::size_t height) {
+  switch (tower_links(height)) {
+  case 1u:
+    return deallocate_tower<1u>(node);
+  case 2u:
+    return deallocate_tower<2u>(node);
+  case 4u:
+    return deallocate_tower<4u>(node);
+  case 8u:
+    return deallocate_tower<8u>(node);
+  case 16u:
+    return deallocate_tower<16u>(node);
+  default:
+    return deallocate_tower<MAX_HEIGHT>(node);
+  }
+}
+
+template<typename T, typename Allocator>
+template<std::size_t Links>
+typename structures::ConcurrentSkipList<T, Allocator>::Node*
+structures::ConcurrentSkipList<T, Allocator>::allocate_tower() {
+  using TowerAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Tower<Links>>;
+  TowerAllocator allocator{allocator_};
+  return reinterpret_cast<Node*>(
+      std::allocator_traits<TowerAllocator>::allocate(allocator, 1u));
+}
+
+template<typename T, typename Allocator>
+template<std::size_t Links>
+void structures::ConcurrentSkipList<T, Allocator>::deallocate_tower(
+    Node* node) {
+  using TowerAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Tower<Links>>;
+  TowerAllocator allocator{allocator_};
+  std::allocator_traits<TowerAllocator>::deallocate(
+      allocator, reinterpret_cast<Tower<Links>*>(node), 1u);
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ConcurrentSkipList<T, Allocator>::tower_links(
+    std::size_t height) {
+  std::size_t links = 1u;
+  while (links < height) {
+    links *= 2;
+  }
+  return links;
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ConcurrentSkipList<T, Allocator>::random_height() {
+  // um gerador xorshift64* por thread
+  thread_local std::uint64_t seed =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1u;
+  seed ^= seed >> 12;
+  seed ^= seed << 25;
+  seed ^= seed >> 27;
+  auto random = (seed * 0x2545f4914f6cdd1dull) | (1ull << 62);
+  // cada par de bits zero à direita sobe um nível (probabilidade 1/4)
+  std::size_t height = 1 + __builtin_ctzll(random) / 2;
+  return height < MAX_HEIGHT ? height : std::size_t(MAX_HEIGHT);
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::search(
+    const T& data, Link** preds, Node** succs) {
+  while (!try_search(data, preds, succs)) {
+  }
+  return succs[0] != nullptr && succs[0]->data == data;
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::try_search(
+    const T& data, Link** preds, Node** succs) {
+  auto links = head_;
+  for (auto level = height_.load(std::memory_order_acquire); level-- > 0;) {
+    auto current = pointer(links[level].load(std::memory_order_acquire));
+    while (current != nullptr) {
+      auto next = current->links()[level].load(std::memory_order_acquire);
+      if (marked(next)) {
+        // ajuda a desligar o nó retirado; falha se links[level] mudou
+        auto expected = link_to(current);
+        if (!links[level].compare_exchange_strong(expected, next & ~MARK)) {
+          return false;
+        }
+        current = pointer(next);
+      } else if (data > current->data) {
+        links = current->links();
+        current = pointer(next);
+      } else {
+        break;
+      }
+    }
+    preds[level] = links;
+    succs[level] = current;
+  }
+  return true;
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::insert(Node* node) {
+  auto height = node->height;
+  auto current = height_.load(std::memory_order_relaxed);
+  while (current < height &&
+         !height_.compare_exchange_weak(current, height)) {
+  }
+  Guard guard{*this};
+  Link* preds[MAX_HEIGHT]{};
+  Node* succs[MAX_HEIGHT]{};
+  // o nó passa a existir quando é ligado no nível 0
+  while (true) {
+    if (search(node->data, preds, succs)) {
+      return false;
+    }
+    for (auto level = 0u; level < height; level++) {
+      node->links()[level].store(link_to(succs[level]),
+                                 std::memory_order_relaxed);
+    }
+    auto expected = link_to(succs[0]);
+    if (preds[0][0].compare_exchange_strong(expected, link_to(node))) {
+      break;
+    }
+  }
+  size_.fetch_add(1u, std::memory_order_relaxed);
+  // os níveis de cima são atalhos; para se remove já marcou o nó
+  for (auto level = 1u; level < height; level++) {
+    if (!link_level(node, level, preds, succs)) {
+      break;
+    }
+  }
+  // remove pode ter desligado o nó antes de um nível ser ligado
+  if (marked(node->links()[0].load(std::memory_order_acquire))) {
+    search(node->data, preds, succs);
+  }
+  return true;
+}
+
+template<typename T, typename Allocator>
+bool structures::ConcurrentSkipList<T, Allocator>::link_level(
+    Node* node, std::size_t level, Link** preds, Node** succs) {
+  auto expected = link_to(succs[level]);
+  while (!preds[level][level].compare_exchange_strong(expected,
+                                                       link_to(node))) {
+    search(node->data, preds, succs);
+    auto link = node->links()[level].load(std::memory_order_acquire);
+    if (marked(link) || !node->links()[level].compare_exchange_strong(
+                            link, link_to(succs[level]))) {
+      return false;
+    }
+    expected = link_to(succs[level]);
+  }
+  return true;
+}
+
+template<typename T, typename Allocator>
+typename structures::ConcurrentSkipList<T, Allocator>::Record*
+structures::ConcurrentSkipList<T, Allocator>::enter() const {
+  struct Hint {
+    std::uint64_t list;
+    Record* record;
+  };
+  // cada thread tenta primeiro o registro que usou da última vez
+  thread_local Hint hint{0u, nullptr};
+  auto record = hint.record;
+  if (hint.list != id_ || record->busy.exchange(true)) {
+    record = records_.load(std::memory_order_acquire);
+    while (record != nullptr &&
+           (record->busy.load(std::memory_order_relaxed) ||
+            record->busy.exchange(true))) {
+      record = record->next;
+    }
+    if (record == nullptr) {
+      record = new Record;
+      record->busy.store(true, std::memory_order_relaxed);
+      record->next = records_.load(std::memory_order_relaxed);
+      while (!records_.compare_exchange_weak(record->next, record)) {
+      }
+    }
+    hint = Hint{id_, record};
+  }
+  auto epoch = epoch_.load(std::memory_order_acquire);
+  record->epoch.store(epoch << 1 | 1u, std::memory_order_release);
+  // a época publicada precisa ser vista antes de qualquer leitura de nó
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return record;
+}
+
+template<typename T, typename Allocator>
+void structures::ConcurrentSkipList<T, Allocator>::leave(
+    Record* record) const {
+  record->epoch.store(0u, std::memory_order_release);
+  record->busy.store(false, std::memory_order_release);
+}
+
+template<typename T, typename Allocator>
+void structures::ConcurrentSkipList<T, Allocator>::retire(Record* record,
+                                                          Node* node) {
+  auto epoch = record->epoch.load(std::memory_order_relaxed) >> 1;
+  auto& retired = record->retired[epoch % 3];
+  // a época avançou duas vezes desde que estes nós foram retirados
+  if (record->collected != epoch) {
+    for (auto old : retired) {
+      destroy_node(old);
+    }
+    retired.clear();
+    record->collected = epoch;
+  }
+  retired.push_back(node);
+  if (retired.size() % RETIRE_BATCH == 0) {
+    try_advance();
+  }
+}
+
+template<typename T, typename Allocator>
+void structures::ConcurrentSkipList<T, Allocator>::try_advance() {
+  auto epoch = epoch_.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto record = records_.load(std::memory_order_acquire);
+  for (; record != nullptr; record = record->next) {
+    auto observed = record->epoch.load(std::memory_order_acquire);
+    if ((observed & 1u) != 0 && observed >> 1 != epoch) {
+      return;
+    }
+  }
+  epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+#endif
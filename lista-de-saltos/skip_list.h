@@ -0,0 +1,532 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_SKIP_LIST_H
+#define STRUCTURES_SKIP_LIST_H
+
+#include <cstddef>  // std::ptrdiff_t
+#include <cstdint>
+#include <iterator>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move, std::forward, std::pair
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+namespace structures {
+
+template<typename T, typename Allocator = std::allocator<T>>
+//! Lista ordenada com saltos: buscas e inserções em O(log n) esperado
+/*!
+  Cada nó tem uma torre de ligações de altura aleatória (cada nível com
+  1/4 dos nós do nível de baixo); as buscas descem pelas torres a partir
+  do nível mais alto. Cada ligação guarda também quantos elementos pula
+  (span), então at, pop e find por posição também são O(log n).
+  Mesma ordem de LinkedList::insert_sorted: iguais ficam na ordem inversa
+  de inserção, e a comparação usa só operator> e operator==.
+*/
+class SkipList {
+ private:
+  struct Node;
+
+ public:
+  //! Iterador (só leitura) em ordem crescente
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    //! elemento atual
+    const T& operator*() const;
+    //! elemento atual
+    const T* operator->() const;
+    //! avança para o próximo elemento
+    Iterator& operator++();
+    //! avança para o próximo elemento
+    Iterator operator++(int);
+    //! compara posições
+    bool operator==(const Iterator& other) const;
+    //! compara posições
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class SkipList;
+    //! iterador no nó node (nullptr: fim)
+    explicit Iterator(const Node* node);
+    //! nó atual
+    const Node* node_;
+  };
+
+  //! construtor
+  SkipList();
+  //! construtor, nós reservados com allocator
+  explicit SkipList(const Allocator& allocator);
+  //! não copiável
+  SkipList(const SkipList&) = delete;
+  //! não copiável
+  SkipList& operator=(const SkipList&) = delete;
+  //! destrutor
+  ~SkipList();
+  //! limpa a lista
+  void clear();
+  //! insere na ordem
+  void insert_sorted(const T& data);
+  //! insere na ordem, movendo o dado
+  void insert_sorted(T&& data);
+  //! acessa na posição
+  const T& at(std::size_t index) const;
+  //! retira da posição
+  T pop(std::size_t index);
+  //! retira o maior
+  T pop_back();
+  //! retira o menor
+  T pop_front();
+  //! retira específico (o primeiro igual, se houver)
+  void remove(const T& data);
+  //! verifica lista vazia
+  bool empty() const;
+  //! verifica se contém
+  bool contains(const T& data) const;
+  //! posição do primeiro igual a data (size() se não encontrar)
+  std::size_t find(const T& data) const;
+  //! tamanho da lista
+  std::size_t size() const;
+  //! primeiro elemento
+  Iterator begin() const;
+  //! depois do último elemento
+  Iterator end() const;
+  //! primeiro elemento que não é menor que data
+  Iterator lower_bound(const T& data) const;
+  //! primeiro elemento maior que data
+  Iterator upper_bound(const T& data) const;
+  //! elementos em [low, high)
+  std::pair<Iterator, Iterator> range(const T& low, const T& high) const;
+
+ private:
+  //! ligação de um nível: próximo nó e quantos elementos ela pula
+  struct Link {
+    //! próximo nó no nível
+    Node* next;
+    //! posição de next menos a posição do dono da ligação
+    std::size_t span;
+  };
+  //! nó: dado e altura; as height ligações vêm logo depois do nó
+  struct Node {
+    //! construtor, dado construído no lugar
+    template<typename... Args>
+    explicit Node(std::size_t height, Args&&... args):
+      data(std::forward<Args>(args)...),
+      height{height}
+    {}
+    //! ligações do nó
+    Link* links() {
+      return reinterpret_cast<Link*>(this + 1);
+    }
+    //! ligações do nó
+    const Link* links() const {
+      return reinterpret_cast<const Link*>(this + 1);
+    }
+    //! dado
+    T data;
+    //! quantidade de ligações
+    std::size_t height;
+  };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! reserva e constrói um nó com height ligações
+  template<typename... Args>
+  Node* create_node(std::size_t height, Args&&... args);
+  //! destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! quantos Node cabem o nó e suas height ligações
+  static std::size_t blocks(std::size_t height);
+  //! altura aleatória: nível i + 1 com probabilidade 1/4 do nível i
+  std::size_t random_height();
+  //! ligações anteriores ao primeiro não menor que data; retorna a posição
+  std::size_t search(const T& data, Link** update) const;
+  //! ligações do nó anterior à posição index em cada nível
+  void search_index(std::size_t index, Link** update) const;
+  //! nó antes do qual data entraria (o primeiro não menor que data)
+  const Node* lower_node(const T& data) const;
+  //! tira de cada nível o nó seguinte às ligações update e o devolve
+  T erase(Link** update);
+  //! insere data antes do primeiro elemento não menor que ele
+  void insert(T&& data);
+  //! altura máxima das torres
+  static const std::size_t MAX_HEIGHT = 32u;
+  //! reserva os nós
+  NodeAllocator allocator_;
+  //! ligações da cabeça, uma por nível
+  Link head_[MAX_HEIGHT];
+  //! níveis em uso
+  std::size_t height_{1u};
+  //! tamanho da lista
+  std::size_t size_{0u};
+  //! estado do gerador de alturas (xorshift64*)
+  std::uint64_t seed_{0x9e3779b97f4a7c15ull};
+};
+
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! SkipList com nós em um std::pmr::memory_resource
+template<typename T>
+using SkipList =
+    structures::SkipList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::SkipList<T, Allocator>::SkipList() {
+  for (auto& link : head_) {
+    link = Link{nullptr, 0u};
+  }
+}
+
+template<typename T, typename Allocator>
+structures::SkipList<T, Allocator>::SkipList(const Allocator& allocator):
+  allocator_{allocator}
+{
+  for (auto& link : head_) {
+    link = Link{nullptr, 0u};
+  }
+}
+
+template<typename T, typename Allocator>
+structures::SkipList<T, Allocator>::~SkipList() {
+  clear();
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::clear() {
+  auto current = head_[0].next;
+  while (current != nullptr) {
+    auto next = current->links()[0].next;
+    destroy_node(current);
+    current = next;
+  }
+  for (auto& link : head_) {
+    link = Link{nullptr, 0u};
+  }
+  height_ = 1;
+  size_ = 0;
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::insert_sorted(const T& data) {
+  insert(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::insert_sorted(T&& data) {
+  insert(std::move(data));
+}
+
+template<typename T, typename Allocator>
+const T& structures::SkipList<T, Allocator>::at(std::size_t index) const {
+  if (index >= size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  Link* update[MAX_HEIGHT]{};
+  search_index(index, update);
+  return update[0][0].next->data;
+}
+
+template<typename T, typename Allocator>
+T structures::SkipList<T, Allocator>::pop(std::size_t index) {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  if (index >= size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  Link* update[MAX_HEIGHT]{};
+  search_index(index, update);
+  return erase(update);
+}
+
+template<typename T, typename Allocator>
+T structures::SkipList<T, Allocator>::pop_back() {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  return pop(size() - 1);
+}
+
+template<typename T, typename Allocator>
+T structures::SkipList<T, Allocator>::pop_front() {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  return pop(0);
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::remove(const T& data) {
+  Link* update[MAX_HEIGHT]{};
+  search(data, update);
+  auto node = update[0][0].next;
+  if (node != nullptr && node->data == data) {
+    erase(update);
+  }
+}
+
+template<typename T, typename Allocator>
+bool structures::SkipList<T, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template<typename T, typename Allocator>
+bool structures::SkipList<T, Allocator>::contains(const T& data) const {
+  auto node = lower_node(data);
+  return node != nullptr && node->data == data;
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SkipList<T, Allocator>::find(const T& data) const {
+  Link* update[MAX_HEIGHT]{};
+  auto rank = search(data, update);
+  auto node = update[0][0].next;
+  if (node != nullptr && node->data == data) {
+    return rank;
+  }
+  return size();
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SkipList<T, Allocator>::size() const {
+  return size_;
+}
+
+template<typename T, typename Allocator>
+typename structures::SkipList<T, Allocator>::Iterator
+structures::SkipList<T, Allocator>::begin() const {
+  return Iterator(head_[0].next);
+}
+
+template<typename T, typename Allocator>
+typename structures::SkipList<T, Allocator>::Iterator
+structures::SkipList<T, Allocator>::end() const {
+  return Iterator(nullptr);
+}
+
+template<typename T, typename Allocator>
+typename structures::SkipList<T, Allocator>::Iterator
+structures::SkipList<T, Allocator>::lower_bound(const T& data) const {
+  return Iterator(lower_node(data));
+}
+
+template<typename T, typename Allocator>
+typename structures::SkipList<T, Allocator>::Iterator
+structures::SkipList<T, Allocator>::upper_bound(const T& data) const {
+  const Link* links = head_;
+  for (auto level = height_; level-- > 0;) {
+    while (links[level].next != nullptr &&
+           !(links[level].next->data > data)) {
+      links = links[level].next->links();
+    }
+  }
+  return Iterator(links[0].next);
+}
+
+template<typename T, typename Allocator>
+std::pair<typename structures::SkipList<T, Allocator>::Iterator,
+          typename structures::SkipList<T, Allocator>::Iterator>
+structures::SkipList<T, Allocator>::range(const T& low, const T& high) const {
+  auto first = lower_bound(low);
+  if (!(high > low)) {
+    return {first, first};
+  }
+  return {first, lower_bound(high)};
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::SkipList<T, Allocator>::Node*
+structures::SkipList<T, Allocator>::create_node(std::size_t height,
+                                                Args&&... args) {
+  auto node = NodeTraits::allocate(allocator_, blocks(height));
+  try {
+    NodeTraits::construct(allocator_, node, height,
+                          std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, blocks(height));
+    throw;
+  }
+  return node;
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::destroy_node(Node* node) {
+  auto count = blocks(node->height);
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, count);
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SkipList<T, Allocator>::blocks(std::size_t height) {
+  return 1 + (height * sizeof(Link) + sizeof(Node) - 1) / sizeof(Node);
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SkipList<T, Allocator>::random_height() {
+  seed_ ^= seed_ >> 12;
+  seed_ ^= seed_ << 25;
+  seed_ ^= seed_ >> 27;
+  auto random = (seed_ * 0x2545f4914f6cdd1dull) | (1ull << 62);
+  // cada par de bits zero à direita sobe um nível (probabilidade 1/4)
+  std::size_t height = 1 + __builtin_ctzll(random) / 2;
+  return height < MAX_HEIGHT ? height : std::size_t(MAX_HEIGHT);
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SkipList<T, Allocator>::search(
+    const T& data, Link** update) const {
+  auto links = const_cast<Link*>(head_);
+  std::size_t rank = 0;
+  for (auto level = height_; level-- > 0;) {
+    while (links[level].next != nullptr && data > links[level].next->data) {
+      rank += links[level].span;
+      links = links[level].next->links();
+    }
+    update[level] = links;
+  }
+  return rank;
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::search_index(
+    std::size_t index, Link** update) const {
+  auto links = const_cast<Link*>(head_);
+  std::size_t rank = 0;
+  for (auto level = height_; level-- > 0;) {
+    // para antes do nó da posição index (rank index + 1)
+    while (links[level].next != nullptr &&
+           rank + links[level].span <= index) {
+      rank += links[level].span;
+      links = links[level].next->links();
+    }
+    update[level] = links;
+  }
+}
+
+template<typename T, typename Allocator>
+const typename structures::SkipList<T, Allocator>::Node*
+structures::SkipList<T, Allocator>::lower_node(const T& data) const {
+  const Link* links = head_;
+  for (auto level = height_; level-- > 0;) {
+    while (links[level].next != nullptr && data > links[level].next->data) {
+      links = links[level].next->links();
+    }
+  }
+  return links[0].next;
+}
+
+template<typename T, typename Allocator>
+T structures::SkipList<T, Allocator>::erase(Link** update) {
+  auto node = update[0][0].next;
+  auto links = node->links();
+  for (auto level = 0u; level < height_; level++) {
+    if (update[level][level].next == node) {
+      update[level][level].span += links[level].span - 1;
+      update[level][level].next = links[level].next;
+    } else {
+      update[level][level].span--;
+    }
+  }
+  while (height_ > 1 && head_[height_ - 1].next == nullptr) {
+    head_[height_ - 1].span = 0;
+    height_--;
+  }
+  size_--;
+  auto data = std::move(node->data);
+  destroy_node(node);
+  return data;
+}
+
+template<typename T, typename Allocator>
+void structures::SkipList<T, Allocator>::insert(T&& data) {
+  Link* update[MAX_HEIGHT]{};
+  std::size_t rank[MAX_HEIGHT];
+  auto links = head_;
+  for (auto level = height_; level-- > 0;) {
+    rank[level] = level + 1 == height_ ? 0 : rank[level + 1];
+    while (links[level].next != nullptr && data > links[level].next->data) {
+      rank[level] += links[level].span;
+      links = links[level].next->links();
+    }
+    update[level] = links;
+  }
+  auto height = random_height();
+  for (; height_ < height; height_++) {
+    // nível novo: a cabeça pula a lista inteira
+    rank[height_] = 0;
+    update[height_] = head_;
+    head_[height_].span = size_;
+  }
+  auto node = create_node(height, std::move(data));
+  auto node_links = node->links();
+  for (auto level = 0u; level < height; level++) {
+    auto& previous = update[level][level];
+    node_links[level].next = previous.next;
+    node_links[level].span = previous.span - (rank[0] - rank[level]);
+    previous.next = node;
+    previous.span = rank[0] - rank[level] + 1;
+  }
+  for (auto level = height; level < height_; level++) {
+    update[level][level].span++;
+  }
+  size_++;
+}
+
+template<typename T, typename Allocator>
+structures::SkipList<T, Allocator>::Iterator::Iterator(const Node* node):
+  node_{node}
+{}
+
+template<typename T, typename Allocator>
+const T& structures::SkipList<T, Allocator>::Iterator::operator*() const {
+  return node_->data;
+}
+
+template<typename T, typename Allocator>
+const T* structures::SkipList<T, Allocator>::Iterator::operator->() const {
+  return &node_->data;
+}
+
+template<typename T, typename Allocator>
+typename structures::SkipList<T, Allocator>::Iterator&
+structures::SkipList<T, Allocator>::Iterator::operator++() {
+  node_ = node_->links()[0].next;
+  return *this;
+}
+
+template<typename T, typename Allocator>
+typename structures::SkipList<T, Allocator>::Iterator
+structures::SkipList<T, Allocator>::Iterator::operator++(int) {
+  auto copy = *this;
+  ++*this;
+  return copy;
+}
+
+template<typename T, typename Allocator>
+bool structures::SkipList<T, Allocator>::Iterator::operator==(
+    const Iterator& other) const {
+  return node_ == other.node_;
+}
+
+template<typename T, typename Allocator>
+bool structures::SkipList<T, Allocator>::Iterator::operator!=(
+    const Iterator& other) const {
+  return !(*this == other);
+}
+
+#endif
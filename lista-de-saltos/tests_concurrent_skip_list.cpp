@@ -0,0 +1,233 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#include "gtest/gtest.h"
+#include "concurrent_skip_list.h"
+#include "../lista-encadeada/node_pool.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+const int THREADS = 4;
+
+//! Roda fn(thread) em THREADS threads
+template<typename F>
+void in_parallel(F fn) {
+    std::vector<std::thread> threads;
+    for (auto thread = 0; thread < THREADS; ++thread) {
+        threads.emplace_back(fn, thread);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+//! Conta os nós vivos (reservados e ainda não devolvidos)
+std::atomic<long> live{0};
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+    CountingAllocator() = default;
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(std::size_t n) {
+        live++;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {
+        live--;
+        std::allocator<T>().deallocate(p, n);
+    }
+    bool operator==(const CountingAllocator&) const { return true; }
+    bool operator!=(const CountingAllocator&) const { return false; }
+};
+
+//! Conta as reservas que SharedPoolAllocator manda para ::operator new
+std::atomic<long> unpooled{0};
+
+template<typename T>
+struct PoolCheckingAllocator {
+    using value_type = T;
+    PoolCheckingAllocator() = default;
+    template<typename U>
+    PoolCheckingAllocator(const PoolCheckingAllocator<U>&) {}
+    T* allocate(std::size_t n) {
+        unpooled += n != 1u;
+        return structures::SharedPoolAllocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {
+        structures::SharedPoolAllocator<T>().deallocate(p, n);
+    }
+    bool operator==(const PoolCheckingAllocator&) const { return true; }
+    bool operator!=(const PoolCheckingAllocator&) const { return false; }
+};
+
+}  // namespace
+
+class ConcurrentSkipListTest: public ::testing::Test {
+protected:
+    structures::ConcurrentSkipList<int> list{};
+};
+
+TEST_F(ConcurrentSkipListTest, Empty) {
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(0u, list.size());
+    ASSERT_FALSE(list.contains(0));
+    ASSERT_FALSE(list.remove(0));
+}
+
+TEST_F(ConcurrentSkipListTest, InsertContainsRemove) {
+    for (auto i = 0; i < 100; ++i) {
+        ASSERT_TRUE(list.insert_sorted((i * 37) % 100));
+    }
+    ASSERT_EQ(100u, list.size());
+    for (auto i = 0; i < 100; ++i) {
+        ASSERT_TRUE(list.contains(i));
+    }
+    ASSERT_FALSE(list.contains(100));
+    ASSERT_FALSE(list.contains(-1));
+    for (auto i = 0; i < 100; i += 2) {
+        ASSERT_TRUE(list.remove(i));
+    }
+    ASSERT_EQ(50u, list.size());
+    for (auto i = 0; i < 100; ++i) {
+        ASSERT_EQ(i % 2 == 1, list.contains(i));
+    }
+}
+
+TEST_F(ConcurrentSkipListTest, NoDuplicates) {
+    ASSERT_TRUE(list.insert_sorted(5));
+    ASSERT_FALSE(list.insert_sorted(5));
+    ASSERT_EQ(1u, list.size());
+    ASSERT_TRUE(list.remove(5));
+    ASSERT_FALSE(list.remove(5));
+    ASSERT_TRUE(list.insert_sorted(5));
+}
+
+TEST(ConcurrentSkipListStringTest, Strings) {
+    structures::ConcurrentSkipList<std::string> list{};
+    ASSERT_TRUE(list.insert_sorted(std::string("b")));
+    ASSERT_TRUE(list.insert_sorted("a"));
+    ASSERT_FALSE(list.insert_sorted(std::string("b")));
+    ASSERT_TRUE(list.contains("a"));
+    ASSERT_TRUE(list.remove("b"));
+    ASSERT_FALSE(list.contains("b"));
+}
+
+TEST(ConcurrentSkipListReclaimTest, ReclaimsRetiredNodes) {
+    {
+        structures::ConcurrentSkipList<int, CountingAllocator<int>> list;
+        for (auto i = 0; i < 100000; ++i) {
+            list.insert_sorted(i);
+            list.remove(i);
+        }
+        // só os nós das últimas épocas esperam para ser liberados
+        ASSERT_GT(1000, live.load());
+    }
+    ASSERT_EQ(0, live.load());
+}
+
+TEST(ConcurrentSkipListPoolTest, TowersFromSharedPool) {
+    structures::ConcurrentSkipList<int, PoolCheckingAllocator<int>> list;
+    // alturas até ~8 aparecem em 20000 nós; cada uma é um só bloco
+    in_parallel([&](int thread) {
+        for (auto i = 0; i < 5000; ++i) {
+            list.insert_sorted(i * THREADS + thread);
+            if (i % 2 == 0) {
+                list.remove(i * THREADS + thread);
+            }
+        }
+    });
+    ASSERT_EQ(2500u * THREADS, list.size());
+    ASSERT_EQ(0, unpooled.load());
+}
+
+TEST_F(ConcurrentSkipListTest, ParallelInsertDisjoint) {
+    in_parallel([this](int thread) {
+        for (auto i = 0; i < 5000; ++i) {
+            ASSERT_TRUE(list.insert_sorted(i * THREADS + thread));
+        }
+    });
+    ASSERT_EQ(5000u * THREADS, list.size());
+    for (auto i = 0; i < 5000 * THREADS; ++i) {
+        ASSERT_TRUE(list.contains(i));
+    }
+}
+
+TEST_F(ConcurrentSkipListTest, ParallelInsertAndRemoveSameKeys) {
+    std::atomic<int> inserted{0};
+    in_parallel([&](int) {
+        for (auto i = 0; i < 5000; ++i) {
+            inserted += list.insert_sorted(i);
+        }
+    });
+    ASSERT_EQ(5000, inserted.load());
+    std::atomic<int> removed{0};
+    in_parallel([&](int) {
+        for (auto i = 0; i < 5000; ++i) {
+            removed += list.remove(i);
+        }
+    });
+    ASSERT_EQ(5000, removed.load());
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(ConcurrentSkipListStressTest, MixedOperations) {
+    const auto keys = 256;
+    {
+        structures::ConcurrentSkipList<int, CountingAllocator<int>> list;
+        std::atomic<int> balance{0};
+        in_parallel([&](int thread) {
+            auto seed = 12345u + thread;
+            for (auto i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                auto key = static_cast<int>((seed >> 8) % keys);
+                switch ((seed >> 24) % 3) {
+                case 0:
+                    balance += list.insert_sorted(key);
+                    break;
+                case 1:
+                    balance -= list.remove(key);
+                    break;
+                default:
+                    list.contains(key);
+                }
+            }
+        });
+        auto present = 0;
+        for (auto key = 0; key < keys; ++key) {
+            present += list.contains(key);
+        }
+        ASSERT_EQ(balance.load(), present);
+        ASSERT_EQ(static_cast<std::size_t>(present), list.size());
+    }
+    ASSERT_EQ(0, live.load());
+}
+
+#if __cplusplus >= 201703L
+TEST(ConcurrentSkipListPmrTest, SynchronizedPool) {
+    std::pmr::synchronized_pool_resource resource;
+    structures::pmr::ConcurrentSkipList<int> list{&resource};
+    in_parallel([&](int thread) {
+        for (auto i = 0; i < 1000; ++i) {
+            list.insert_sorted(i * THREADS + thread);
+            if (i % 2 == 0) {
+                list.remove(i * THREADS + thread);
+            }
+        }
+    });
+    ASSERT_EQ(500u * THREADS, list.size());
+}
+#endif
@@ -0,0 +1,182 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#include "gtest/gtest.h"
+#include "skip_list.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+class SkipListTest: public ::testing::Test {
+protected:
+    structures::SkipList<int> list{};
+};
+
+TEST_F(SkipListTest, InsertInOrder) {
+    for (auto i = 9; i >= 0; --i) {
+        list.insert_sorted(i);
+    }
+    ASSERT_EQ(10u, list.size());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list.at(i));
+    }
+    ASSERT_THROW(list.at(10), std::out_of_range);
+}
+
+TEST_F(SkipListTest, Empty) {
+    ASSERT_TRUE(list.empty());
+    ASSERT_THROW(list.at(0), std::out_of_range);
+    ASSERT_THROW(list.pop(0), std::out_of_range);
+    ASSERT_THROW(list.pop_back(), std::out_of_range);
+    ASSERT_THROW(list.pop_front(), std::out_of_range);
+    ASSERT_EQ(0u, list.find(0));
+    ASSERT_FALSE(list.contains(0));
+    ASSERT_TRUE(list.begin() == list.end());
+}
+
+TEST_F(SkipListTest, FindAndContains) {
+    for (auto i = 0; i < 100; ++i) {
+        list.insert_sorted(2 * i);
+    }
+    ASSERT_EQ(21u, list.find(42));
+    ASSERT_TRUE(list.contains(42));
+    ASSERT_EQ(list.size(), list.find(43));
+    ASSERT_FALSE(list.contains(43));
+    ASSERT_FALSE(list.contains(-1));
+    ASSERT_FALSE(list.contains(1000));
+}
+
+TEST_F(SkipListTest, Duplicates) {
+    list.insert_sorted(5);
+    list.insert_sorted(1);
+    list.insert_sorted(5);
+    list.insert_sorted(5);
+    list.insert_sorted(9);
+    ASSERT_EQ(1u, list.find(5));
+    list.remove(5);
+    ASSERT_EQ(4u, list.size());
+    ASSERT_TRUE(list.contains(5));
+    list.remove(5);
+    list.remove(5);
+    ASSERT_FALSE(list.contains(5));
+    list.remove(5);
+    ASSERT_EQ(2u, list.size());
+}
+
+TEST_F(SkipListTest, Pop) {
+    for (auto i = 0; i < 10; ++i) {
+        list.insert_sorted(i);
+    }
+    ASSERT_EQ(5, list.pop(5));
+    ASSERT_EQ(6, list.pop(5));
+    ASSERT_EQ(9, list.pop_back());
+    ASSERT_EQ(0, list.pop_front());
+    ASSERT_EQ(6u, list.size());
+    ASSERT_THROW(list.pop(6), std::out_of_range);
+    std::vector<int> expected{1, 2, 3, 4, 7, 8};
+    for (auto i = 0u; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], list.at(i));
+    }
+}
+
+TEST_F(SkipListTest, IterationAndRanges) {
+    for (auto i = 0; i < 100; ++i) {
+        list.insert_sorted((i * 37) % 100);
+    }
+    auto expected = 0;
+    for (auto data : list) {
+        ASSERT_EQ(expected++, data);
+    }
+    ASSERT_EQ(100, expected);
+    ASSERT_EQ(10, *list.lower_bound(10));
+    ASSERT_EQ(11, *list.upper_bound(10));
+    ASSERT_TRUE(list.lower_bound(100) == list.end());
+    auto range = list.range(20, 25);
+    std::vector<int> in_range(range.first, range.second);
+    ASSERT_EQ((std::vector<int>{20, 21, 22, 23, 24}), in_range);
+    range = list.range(25, 20);
+    ASSERT_TRUE(range.first == range.second);
+}
+
+TEST(SkipListReferenceTest, MatchesSortedVector) {
+    // operações aleatórias comparadas com um vetor ordenado
+    std::srand(42);
+    structures::SkipList<int> list;
+    std::vector<int> reference;
+    for (auto step = 0; step < 20000; ++step) {
+        auto value = std::rand() % 1000;
+        auto operation = std::rand() % 5;
+        if (operation < 2 || reference.empty()) {
+            list.insert_sorted(value);
+            reference.insert(std::lower_bound(reference.begin(),
+                                              reference.end(), value), value);
+        } else if (operation == 2) {
+            auto index = std::rand() % reference.size();
+            ASSERT_EQ(reference[index], list.pop(index));
+            reference.erase(reference.begin() + index);
+        } else if (operation == 3) {
+            list.remove(value);
+            auto it = std::lower_bound(reference.begin(), reference.end(),
+                                       value);
+            if (it != reference.end() && *it == value) {
+                reference.erase(it);
+            }
+        } else {
+            auto it = std::lower_bound(reference.begin(), reference.end(),
+                                       value);
+            auto expected = it != reference.end() && *it == value ?
+                            it - reference.begin() : reference.size();
+            ASSERT_EQ(static_cast<std::size_t>(expected), list.find(value));
+        }
+        ASSERT_EQ(reference.size(), list.size());
+    }
+    for (auto i = 0u; i < reference.size(); ++i) {
+        ASSERT_EQ(reference[i], list.at(i));
+    }
+    ASSERT_TRUE(std::equal(reference.begin(), reference.end(), list.begin()));
+}
+
+TEST(SkipListMoveTest, Strings) {
+    structures::SkipList<std::string> list{};
+    list.insert_sorted(std::string("c"));
+    list.insert_sorted("a");
+    list.insert_sorted(std::string(3u, 'b'));
+    ASSERT_EQ("a", list.at(0));
+    ASSERT_EQ("bbb", list.at(1));
+    ASSERT_EQ("c", list.pop_back());
+    ASSERT_TRUE(list.contains("bbb"));
+}
+
+TEST(SkipListMoveTest, MoveOnlyElements) {
+    structures::SkipList<std::unique_ptr<int>> list{};
+    for (auto i = 0; i < 10; ++i) {
+        list.insert_sorted(std::unique_ptr<int>(new int(i)));
+    }
+    // ordenados pelo endereço: só confere que nada se perde
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_NE(nullptr, list.pop_front());
+    }
+    ASSERT_TRUE(list.empty());
+}
+
+#if __cplusplus >= 201703L
+TEST(SkipListPmrTest, MonotonicBuffer) {
+    alignas(std::max_align_t) char buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::SkipList<int> list{&resource};
+    for (auto i = 0; i < 1000; i++) {
+        list.insert_sorted(999 - i);
+    }
+    ASSERT_EQ(500u, list.find(500));
+}
+#endif
@@ -0,0 +1,57 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de acesso por posição em DoublyLinkedList.
+// Compilar: g++ -O2 -std=c++14 bench_doubly_linked_list.cpp
+//           -o bench_doubly_linked_list
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "doubly_linked_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+const unsigned RANDOM_ACCESSES = 2000u;
+
+int main() {
+  std::printf("tempos em ms; aleatório: %u acessos\n", RANDOM_ACCESSES);
+  for (auto n : {1000u, 10000u, 50000u}) {
+    structures::DoublyLinkedList<int> list;
+    for (auto i = 0u; i < n; i++) {
+      list.push_back(static_cast<int>(i));
+    }
+    long long checksum = 0;
+    auto forward = measure([&] {
+      for (auto i = 0u; i < n; i++) {
+        checksum += list.at(i);
+      }
+    });
+    auto backward = measure([&] {
+      for (auto i = n; i-- > 0;) {
+        checksum += list.at(i);
+      }
+    });
+    std::srand(42);
+    auto random = measure([&] {
+      for (auto i = 0u; i < RANDOM_ACCESSES; i++) {
+        checksum += list.at(std::rand() % n);
+      }
+    });
+    // inserções e retiradas perto do fim
+    auto near_tail = measure([&] {
+      for (auto i = 0u; i < RANDOM_ACCESSES; i++) {
+        list.insert(static_cast<int>(i), list.size() - 1 - i % 16);
+        checksum += list.pop(list.size() - 2 - i % 16);
+      }
+    });
+    std::printf("n=%-6u sequencial %9.2f  reverso %9.2f  aleatório %8.2f"
+                "  perto do fim %8.2f  (%lld)\n", n, forward, backward,
+                random, near_tail, checksum);
+  }
+  return 0;
+}
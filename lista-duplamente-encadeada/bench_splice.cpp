@@ -0,0 +1,67 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de splice/merge em DoublyLinkedList contra pop/insert.
+// Compilar: g++ -O2 -std=c++14 bench_splice.cpp -o bench_splice
+#include <chrono>
+#include <cstdio>
+#include "doubly_linked_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+using List = structures::DoublyLinkedList<int>;
+
+//! Lista com os valores first, first + step, ... (n valores)
+List make(unsigned n, int first, int step) {
+  List list;
+  for (auto i = 0u; i < n; i++) {
+    list.push_back(first + static_cast<int>(i) * step);
+  }
+  return list;
+}
+
+int main() {
+  std::printf("tempos em ms\n");
+  for (auto n : {1000u, 10000u, 30000u}) {
+    long long checksum = 0;
+    // move a metade do meio de uma lista para o meio de outra
+    auto a = make(n, 0, 1);
+    auto b = make(n, 0, 1);
+    auto moved = measure([&] {
+      for (auto i = n / 4; i < 3 * n / 4; i++) {
+        b.insert(a.pop(n / 4), n / 2);
+      }
+    });
+    checksum += b.at(n / 2);
+    auto c = make(n, 0, 1);
+    auto d = make(n, 0, 1);
+    auto spliced = measure([&] {
+      d.splice(n / 2, c, n / 4, 3 * n / 4);
+    });
+    checksum += d.at(n / 2);
+    // intercala pares e ímpares
+    auto even = make(n, 0, 2);
+    auto odd = make(n, 1, 2);
+    auto inserted = measure([&] {
+      while (!odd.empty()) {
+        even.insert_sorted(odd.pop_front());
+      }
+    });
+    checksum += even.at(n);
+    auto even2 = make(n, 0, 2);
+    auto odd2 = make(n, 1, 2);
+    auto merged = measure([&] {
+      even2.merge(odd2);
+    });
+    checksum += even2.at(n);
+    std::printf("n=%-7u pop+insert %9.2f  splice %7.3f  |  insert_sorted "
+                "%9.2f  merge %7.3f  (%lld)\n", n, moved, spliced, inserted,
+                merged, checksum);
+  }
+  return 0;
+}
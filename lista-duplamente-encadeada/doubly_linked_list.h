@@ -1,27 +1,158 @@
 //! Copyright [2021] Gabriel de Vargas Coelho
+#ifndef STRUCTURES_DOUBLY_LINKED_LIST_H
+#define STRUCTURES_DOUBLY_LINKED_LIST_H
+
+#include <cstddef>  // std::ptrdiff_t
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
 //! Classe lista duplamente encadeada
-template<typename T>
+/*!
+  O acesso por posição parte do extremo mais próximo ou do último nó
+  acessado (o "dedo"), então percorrer com at(i), at(i + 1), ... custa
+  O(1) por passo. O dedo é atualizado mesmo por at() const: leituras
+  concorrentes da mesma lista precisam de sincronização externa.
+*/
+template<typename T, typename Allocator = std::allocator<T>>
 class DoublyLinkedList {
+ private:
+  class Node;
+
  public:
+  //! Iterador bidirecional; Value é T ou const T
+  template<typename Value>
+  class BasicIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename std::remove_const<Value>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    //! Iterador nulo
+    BasicIterator() = default;
+    //! Converte Iterator em ConstIterator
+    template<typename Other, typename = typename std::enable_if<
+        std::is_same<const Other, Value>::value>::type>
+    BasicIterator(const BasicIterator<Other>& other):  // NOLINT
+      node_{other.node_},
+      list_{other.list_}
+    {}
+    //! Elemento atual
+    reference operator*() const {
+      return node_->data();
+    }
+    //! Elemento atual
+    pointer operator->() const {
+      return &node_->data();
+    }
+    //! Avança para o próximo elemento
+    BasicIterator& operator++() {
+      node_ = node_->next();
+      return *this;
+    }
+    //! Avança para o próximo elemento
+    BasicIterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+    //! Volta para o elemento anterior (do fim, vai para o último)
+    BasicIterator& operator--() {
+      node_ = node_ == nullptr ? list_->tail : node_->prev();
+      return *this;
+    }
+    //! Volta para o elemento anterior
+    BasicIterator operator--(int) {
+      auto old = *this;
+      --*this;
+      return old;
+    }
+    //! Compara posições
+    bool operator==(const BasicIterator& other) const {
+      return node_ == other.node_;
+    }
+    //! Compara posições
+    bool operator!=(const BasicIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class DoublyLinkedList;
+    template<typename> friend class BasicIterator;
+    //! Node* ou const Node*
+    using NodePointer = typename std::conditional<
+        std::is_const<Value>::value, const Node*, Node*>::type;
+    //! DoublyLinkedList* ou const DoublyLinkedList*
+    using ListPointer = typename std::conditional<
+        std::is_const<Value>::value, const DoublyLinkedList*,
+        DoublyLinkedList*>::type;
+    //! Iterador no nó node de list (nullptr: fim)
+    BasicIterator(NodePointer node, ListPointer list):
+      node_{node},
+      list_{list}
+    {}
+    //! Nó atual
+    NodePointer node_{nullptr};
+    //! Lista percorrida, para voltar do fim
+    ListPointer list_{nullptr};
+  };
+  //! Iterador bidirecional
+  using Iterator = BasicIterator<T>;
+  //! Iterador bidirecional, só leitura
+  using ConstIterator = BasicIterator<const T>;
+
   //! Construtor
   DoublyLinkedList();
+  //! Construtor, nós reservados com allocator
+  explicit DoublyLinkedList(const Allocator& allocator);
+  //! Construtor de movimento: toma os nós de other
+  DoublyLinkedList(DoublyLinkedList&& other);
+  //! Atribuição de movimento
+  DoublyLinkedList& operator=(DoublyLinkedList&& other);
   //! Destrutor
   ~DoublyLinkedList();
   //! Limpa lista
   void clear();
   //! Adiciona ao final
   void push_back(const T& data);
+  //! Adiciona ao final, movendo o dado
+  void push_back(T&& data);
   //! Adiciona no início
   void push_front(const T& data);
+  //! Adiciona no início, movendo o dado
+  void push_front(T&& data);
   //! Adiciona na posição
   void insert(const T& data, std::size_t index);
+  //! Adiciona na posição, movendo o dado
+  void insert(T&& data, std::size_t index);
   //! Adiciona ordenadamente
   void insert_sorted(const T& data);
+  //! Adiciona ordenadamente, movendo o dado
+  void insert_sorted(T&& data);
+  //! Constrói ao final
+  template<typename... Args>
+  void emplace_back(Args&&... args);
+  //! Constrói no início
+  template<typename... Args>
+  void emplace_front(Args&&... args);
+  //! Constrói na posição
+  template<typename... Args>
+  void emplace(std::size_t index, Args&&... args);
   //! Retira da posição
   T pop(std::size_t index);
+  //! Retira o elemento em position, em O(1)
+  T pop(Iterator position);
   //! Retira do fim
   T pop_back();
   //! Retira do início
@@ -40,25 +171,42 @@ class DoublyLinkedList {
   std::size_t find(const T& data) const;
   //! Tamanho
   std::size_t size() const;
+  //! Ordena a lista: merge sort estável que religa os nós, sem alocar
+  void sort();
+  //! Move todos os nós de other para antes da posição index
+  void splice(std::size_t index, DoublyLinkedList& other);
+  //! Move o nó da posição from de other para antes da posição index
+  void splice(std::size_t index, DoublyLinkedList& other, std::size_t from);
+  //! Move os nós [first, last) de other para antes da posição index
+  void splice(std::size_t index, DoublyLinkedList& other, std::size_t first,
+              std::size_t last);
+  //! Move o nó em it de other para antes de position, em O(1)
+  void splice(Iterator position, DoublyLinkedList& other, Iterator it);
+  //! Tira os elementos a partir da posição index para uma nova lista
+  DoublyLinkedList split_at(std::size_t index);
+  //! Intercala other nesta lista, as duas em ordem; estável, sem alocar
+  void merge(DoublyLinkedList& other);
+  //! Primeiro elemento
+  Iterator begin();
+  //! Depois do último elemento
+  Iterator end();
+  //! Primeiro elemento, só leitura
+  ConstIterator begin() const;
+  //! Depois do último elemento, só leitura
+  ConstIterator end() const;
+  //! Primeiro elemento, só leitura
+  ConstIterator cbegin() const;
+  //! Depois do último elemento, só leitura
+  ConstIterator cend() const;
 
  private:
   //! Classe nó
   class Node {
    public:
-    //! Construtor
-    explicit Node(const T& data):
-      data_{data}
-    {}
-    //! Construtor, próximo parametrizado
-    Node(const T& data, Node* next):
-      data_{data},
-      next_{next}
-    {}
-    //! Construtor parametrizado
-    Node(const T& data, Node* prev, Node* next):
-      data_{data},
-      prev_{prev},
-      next_{next}
+    //! Construtor, dado construído no lugar
+    template<typename... Args>
+    explicit Node(Args&&... args):
+      data_(std::forward<Args>(args)...)
     {}
     //! Dado
     T& data() {
@@ -101,6 +249,30 @@ class DoublyLinkedList {
     //! Próximo
     Node* next_{nullptr};
   };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! Reserva e constrói um nó
+  template<typename... Args>
+  Node* create_node(Args&&... args);
+  //! Destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! Nó da posição index, a partir do extremo ou do dedo mais próximo
+  Node* node_at(std::size_t index) const;
+  //! Liga a cadeia first..last antes de position (nullptr: no fim)
+  void link(Node* position, Node* first, Node* last);
+  //! Desliga a cadeia first..last da lista
+  void unlink(Node* first, Node* last);
+  //! Exige que other reserve nós com o mesmo alocador
+  void check_allocator(const DoublyLinkedList& other) const;
+  //! Ordena a cadeia chain terminada em nullptr; devolve o primeiro nó
+  static Node* merge_sort(Node* chain);
+  //! Intercala as cadeias ordenadas left e right; iguais de left antes
+  static Node* merge_chains(Node* left, Node* right);
+  //! Reserva os nós
+  NodeAllocator allocator_;
 
   //! Primeiro da lista
   Node* head{nullptr};
@@ -108,41 +280,154 @@ class DoublyLinkedList {
   Node* tail{nullptr};
   //! Tamanho
   std::size_t size_{0u};
+  //! Último nó acessado por posição (nullptr: nenhum)
+  mutable Node* finger_{nullptr};
+  //! Posição de finger_
+  mutable std::size_t finger_index_{0u};
 };
 
-}  //  namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! DoublyLinkedList com nós em um std::pmr::memory_resource
 template<typename T>
-structures::DoublyLinkedList<T>::DoublyLinkedList() {
+using DoublyLinkedList =
+    structures::DoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  //  namespace structures
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList() {
   size_ = 0;
   head = nullptr;
   tail = nullptr;
 }
 
-template<typename T>
-structures::DoublyLinkedList<T>::~DoublyLinkedList() {
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+    const Allocator& allocator):
+  allocator_{allocator}
+{
+  size_ = 0;
+  head = nullptr;
+  tail = nullptr;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+    DoublyLinkedList&& other):
+  allocator_{std::move(other.allocator_)},
+  head{other.head},
+  tail{other.tail},
+  size_{other.size_}
+{
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.size_ = 0;
+  other.finger_ = nullptr;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>&
+structures::DoublyLinkedList<T, Allocator>::operator=(
+    DoublyLinkedList&& other) {
+  if (this != &other) {
+    clear();
+    if (allocator_ == other.allocator_) {
+      splice(0, other);
+    } else {
+      // nós de outro alocador não podem ser devolvidos por este; o dado
+      // só sai de other depois de inserido, caso reservar o nó falhe
+      while (!other.empty()) {
+        push_back(std::move(other.head->data()));
+        other.pop_front();
+      }
+    }
+  }
+  return *this;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
   clear();
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::clear() {
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::clear() {
   Node* current = head;
   while (current != nullptr) {
     auto next = current->next();
-    delete current;
+    destroy_node(current);
     current = next;
   }
   head = nullptr;
   tail = nullptr;
   size_ = 0;
+  finger_ = nullptr;
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::push_back(const T& data) {
-  Node* element = new Node(data, tail, nullptr);
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert(
+    const T& data, std::size_t index) {
+  emplace(index, data);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert(
+    T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert_sorted(const T& data) {
+  insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert_sorted(T&& data) {
+  if (size() == 0) {
+    return push_front(std::move(data));
+  }
+  auto pos = 0u;
+  auto current = head;
+  while (current != nullptr && data > current->data()) {
+    current = current->next();
+    pos++;
+  }
+  return insert(std::move(data), pos);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::DoublyLinkedList<T, Allocator>::emplace_back(Args&&... args) {
+  Node* element = create_node(std::forward<Args>(args)...);
   if (element == nullptr) {
     throw std::out_of_range("Lista cheia");
   }
+  element->prev(tail);
   if (size() == 0) {
     head = element;
   } else {
@@ -152,12 +437,14 @@ void structures::DoublyLinkedList<T>::push_back(const T& data) {
   size_++;
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::push_front(const T& data) {
-  Node* element = new Node(data, head);
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::DoublyLinkedList<T, Allocator>::emplace_front(Args&&... args) {
+  Node* element = create_node(std::forward<Args>(args)...);
   if (element == nullptr) {
     throw std::out_of_range("Lista cheia");
   }
+  element->next(head);
   if (size() == 0) {
     tail = element;
   } else {
@@ -165,55 +452,45 @@ void structures::DoublyLinkedList<T>::push_front(const T& data) {
   }
   head = element;
   size_++;
+  finger_index_++;
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::DoublyLinkedList<T, Allocator>::emplace(
+    std::size_t index, Args&&... args) {
   if (index > size()) {
     throw std::out_of_range("Índice fora dos limites");
   }
   if (index == 0) {
-    return push_front(data);
+    return emplace_front(std::forward<Args>(args)...);
   }
   if (index == size()) {
-    return push_back(data);
+    return emplace_back(std::forward<Args>(args)...);
   }
-  Node* element = new Node(data);
+  Node* element = create_node(std::forward<Args>(args)...);
   if (element == nullptr) {
     throw std::out_of_range("Lista cheia");
   }
-  auto current = head;
-  for (auto pos = 0u; pos < index; pos++) {
-    current = current->next();
-  }
+  auto current = node_at(index);
   element->next(current);
   element->prev(current->prev());
   current->prev()->next(element);
   current->prev(element);
   size_++;
+  finger_ = element;
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
-  if (size() == 0) {
-    return push_front(data);
-  }
-  auto pos = 0u;
-  auto current = head;
-  while (current != nullptr && data > current->data()) {
-    current = current->next();
-    pos++;
-  }
-  return insert(data, pos);
-}
-
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop_back() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   auto previous_tail = tail;
-  auto data = previous_tail->data();
+  if (finger_ == previous_tail) {
+    finger_ = nullptr;
+  }
+  auto data = std::move(previous_tail->data());
   if (size() != 1) {
     previous_tail->prev()->next(nullptr);
     tail = previous_tail->prev();
@@ -221,32 +498,36 @@ T structures::DoublyLinkedList<T>::pop_back() {
     head = nullptr;
     tail = nullptr;
   }
-  delete previous_tail;
+  destroy_node(previous_tail);
   size_--;
   return data;
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop_front() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   if (size() == 1) {
     tail = nullptr;
   }
-  auto data = head->data();
+  if (finger_ == head) {
+    finger_ = nullptr;
+  }
+  finger_index_--;
+  auto data = std::move(head->data());
   auto previous_head = head;
   head = previous_head->next();
   if (head != nullptr) {
     head->prev(nullptr);
   }
-  delete previous_head;
+  destroy_node(previous_head);
   size_--;
   return data;
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
@@ -259,20 +540,34 @@ T structures::DoublyLinkedList<T>::pop(std::size_t index) {
   if (index == size() - 1) {
     return pop_back();
   }
-  auto current = head;
-  for (auto pos = 0u; pos < index; pos++) {
-    current = current->next();
-  }
+  auto current = node_at(index);
   current->prev()->next(current->next());
   current->next()->prev(current->prev());
-  auto data = current->data();
-  delete current;
+  // o seguinte passa a ocupar a posição index
+  finger_ = current->next();
+  auto data = std::move(current->data());
+  destroy_node(current);
   size_--;
   return data;
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop(Iterator position) {
+  auto current = position.node_;
+  if (current == nullptr) {
+    throw std::out_of_range("Índice fora dos limites");
+  }
+  unlink(current, current);
+  // a posição do dedo pode ter mudado
+  finger_ = nullptr;
+  auto data = std::move(current->data());
+  destroy_node(current);
+  size_--;
+  return data;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::remove(const T& data) {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
@@ -281,13 +576,13 @@ void structures::DoublyLinkedList<T>::remove(const T& data) {
   pop(pos);
 }
 
-template<typename T>
-bool structures::DoublyLinkedList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::DoublyLinkedList<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template<typename T>
-bool structures::DoublyLinkedList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::DoublyLinkedList<T, Allocator>::contains(const T& data) const {
   auto current = head;
   while (current != nullptr) {
     if (current->data() == data) {
@@ -298,32 +593,26 @@ bool structures::DoublyLinkedList<T>::contains(const T& data) const {
   return false;
 }
 
-template<typename T>
-T& structures::DoublyLinkedList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::DoublyLinkedList<T, Allocator>::at(std::size_t index) {
   if (index >= size()) {
     throw std::out_of_range("Índice fora dos limites");
   }
-  auto current = head;
-  for (auto pos = 0u; pos < index; pos++) {
-    current = current->next();
-  }
-  return current->data();
+  return node_at(index)->data();
 }
 
-template<typename T>
-const T& structures::DoublyLinkedList<T>::at(std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::DoublyLinkedList<T, Allocator>::at(
+    std::size_t index) const {
   if (index >= size()) {
     throw std::out_of_range("Índice fora dos limites");
   }
-  auto current = head;
-  for (auto pos = 0u; pos < index; pos++) {
-    current = current->next();
-  }
-  return current->data();
+  return node_at(index)->data();
 }
 
-template<typename T>
-std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyLinkedList<T, Allocator>::find(
+    const T& data) const {
   auto current = head;
   auto pos = 0u;
   while (current != nullptr && current->data() != data) {
@@ -333,7 +622,323 @@ std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
   return pos;
 }
 
-template<typename T>
-std::size_t structures::DoublyLinkedList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyLinkedList<T, Allocator>::size() const {
   return size_;
 }
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::sort() {
+  if (size() < 2u) {
+    return;
+  }
+  head = merge_sort(head);
+  // a ordenação só religa next: refaz prev e acha o último
+  Node* previous = nullptr;
+  for (auto current = head; current != nullptr; current = current->next()) {
+    current->prev(previous);
+    previous = current;
+  }
+  tail = previous;
+  finger_ = nullptr;
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::Node*
+structures::DoublyLinkedList<T, Allocator>::merge_sort(Node* chain) {
+  // de baixo para cima: bins[k] guarda uma sequência ordenada de 2^k nós
+  // (ou nenhuma); cada nó entra como sequência de um e sobe intercalando,
+  // enquanto as sequências curtas ainda estão em cache
+  Node* bins[std::numeric_limits<std::size_t>::digits] = {};
+  auto used = 0u;
+  while (chain != nullptr) {
+    auto carry = chain;
+    chain = chain->next();
+    carry->next(nullptr);
+    auto k = 0u;
+    for (; k < used && bins[k] != nullptr; k++) {
+      // bins[k] veio antes na lista: fica à esquerda
+      carry = merge_chains(bins[k], carry);
+      bins[k] = nullptr;
+    }
+    if (k == used) {
+      used++;
+    }
+    bins[k] = carry;
+  }
+  Node* sorted = nullptr;
+  for (auto k = 0u; k < used; k++) {
+    sorted = merge_chains(bins[k], sorted);
+  }
+  return sorted;
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::Node*
+structures::DoublyLinkedList<T, Allocator>::merge_chains(
+    Node* left, Node* right) {
+  if (left == nullptr) {
+    return right;
+  }
+  if (right == nullptr) {
+    return left;
+  }
+  Node* first = nullptr;
+  Node* last = nullptr;
+  while (left != nullptr && right != nullptr) {
+    Node* next;
+    if (left->data() > right->data()) {
+      next = right;
+      right = right->next();
+    } else {
+      next = left;
+      left = left->next();
+    }
+    if (last == nullptr) {
+      first = next;
+    } else {
+      last->next(next);
+    }
+    last = next;
+  }
+  last->next(left != nullptr ? left : right);
+  return first;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::splice(
+    std::size_t index, DoublyLinkedList& other) {
+  splice(index, other, 0, other.size());
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::splice(
+    std::size_t index, DoublyLinkedList& other, std::size_t from) {
+  splice(index, other, from, from + 1);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::splice(
+    std::size_t index, DoublyLinkedList& other, std::size_t first,
+    std::size_t last) {
+  check_allocator(other);
+  if (index > size() || first > last || last > other.size()) {
+    throw std::out_of_range("Índice fora dos limites");
+  }
+  if (&other == this && index >= first && index <= last) {
+    if (index > first && index < last) {
+      throw std::out_of_range("Índice dentro do intervalo movido");
+    }
+    return;  // o intervalo já está na posição
+  }
+  if (first == last) {
+    return;
+  }
+  // localiza tudo antes de mudar as posições
+  auto position = index == size() ? nullptr : node_at(index);
+  auto first_node = other.node_at(first);
+  auto last_node = other.node_at(last - 1);
+  other.unlink(first_node, last_node);
+  other.size_ -= last - first;
+  other.finger_ = nullptr;
+  link(position, first_node, last_node);
+  size_ += last - first;
+  finger_ = nullptr;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::splice(
+    Iterator position, DoublyLinkedList& other, Iterator it) {
+  check_allocator(other);
+  auto node = it.node_;
+  if (node == nullptr) {
+    throw std::out_of_range("Índice fora dos limites");
+  }
+  if (&other == this && (position.node_ == node ||
+                         position.node_ == node->next())) {
+    return;  // o nó já está na posição
+  }
+  other.unlink(node, node);
+  other.size_--;
+  other.finger_ = nullptr;
+  link(position.node_, node, node);
+  size_++;
+  finger_ = nullptr;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>
+structures::DoublyLinkedList<T, Allocator>::split_at(std::size_t index) {
+  if (index > size()) {
+    throw std::out_of_range("Índice fora dos limites");
+  }
+  DoublyLinkedList rest{Allocator(allocator_)};
+  rest.splice(0, *this, index, size());
+  return rest;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::merge(
+    DoublyLinkedList& other) {
+  if (&other == this) {
+    return;
+  }
+  check_allocator(other);
+  auto current = head;
+  while (other.head != nullptr) {
+    if (current == nullptr) {
+      // o resto de other é maior que todos desta lista
+      link(nullptr, other.head, other.tail);
+      break;
+    }
+    if (current->data() > other.head->data()) {
+      // iguais ficam depois dos desta lista: merge estável
+      auto node = other.head;
+      other.head = node->next();
+      link(current, node, node);
+    } else {
+      current = current->next();
+    }
+  }
+  size_ += other.size_;
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.size_ = 0;
+  other.finger_ = nullptr;
+  finger_ = nullptr;
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::Node*
+structures::DoublyLinkedList<T, Allocator>::node_at(std::size_t index) const {
+  auto current = head;
+  auto position = std::size_t{0u};
+  auto distance = index;
+  if (size_ - 1 - index < distance) {
+    current = tail;
+    position = size_ - 1;
+    distance = size_ - 1 - index;
+  }
+  if (finger_ != nullptr) {
+    auto from_finger = finger_index_ > index ? finger_index_ - index :
+                                               index - finger_index_;
+    if (from_finger < distance) {
+      current = finger_;
+      position = finger_index_;
+    }
+  }
+  while (position < index) {
+    current = current->next();
+    position++;
+  }
+  while (position > index) {
+    current = current->prev();
+    position--;
+  }
+  finger_ = current;
+  finger_index_ = index;
+  return current;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::link(
+    Node* position, Node* first, Node* last) {
+  auto previous = position == nullptr ? tail : position->prev();
+  first->prev(previous);
+  last->next(position);
+  if (previous == nullptr) {
+    head = first;
+  } else {
+    previous->next(first);
+  }
+  if (position == nullptr) {
+    tail = last;
+  } else {
+    position->prev(last);
+  }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::unlink(
+    Node* first, Node* last) {
+  auto previous = first->prev();
+  auto next = last->next();
+  if (previous == nullptr) {
+    head = next;
+  } else {
+    previous->next(next);
+  }
+  if (next == nullptr) {
+    tail = previous;
+  } else {
+    next->prev(previous);
+  }
+  first->prev(nullptr);
+  last->next(nullptr);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::check_allocator(
+    const DoublyLinkedList& other) const {
+  if (!(allocator_ == other.allocator_)) {
+    throw std::invalid_argument("Listas com alocadores diferentes");
+  }
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::Iterator
+structures::DoublyLinkedList<T, Allocator>::begin() {
+  return Iterator(head, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::Iterator
+structures::DoublyLinkedList<T, Allocator>::end() {
+  return Iterator(nullptr, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::ConstIterator
+structures::DoublyLinkedList<T, Allocator>::begin() const {
+  return ConstIterator(head, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::ConstIterator
+structures::DoublyLinkedList<T, Allocator>::end() const {
+  return ConstIterator(nullptr, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::ConstIterator
+structures::DoublyLinkedList<T, Allocator>::cbegin() const {
+  return begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::ConstIterator
+structures::DoublyLinkedList<T, Allocator>::cend() const {
+  return end();
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::DoublyLinkedList<T, Allocator>::Node*
+structures::DoublyLinkedList<T, Allocator>::create_node(Args&&... args) {
+  auto node = NodeTraits::allocate(allocator_, 1);
+  try {
+    NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
+#endif
@@ -1,5 +1,17 @@
 #include "gtest/gtest.h"
 #include "doubly_linked_list.h"
+#include "../lista-encadeada/node_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -207,3 +219,381 @@ TEST_F(DoublyLinkedListTest, RemoveElement) {
     ASSERT_EQ(9u, list.size());
     ASSERT_FALSE(list.contains(4));
 }
+
+TEST(DoublyLinkedListMoveTest, SpliceKeepsElement) {
+    // splice passa o nó inteiro de uma lista para outra: o elemento não
+    // sai do lugar até pop(Iterator) movê-lo para fora do nó
+    structures::DoublyLinkedList<std::unique_ptr<int>> a{};
+    structures::DoublyLinkedList<std::unique_ptr<int>> b{};
+    for (auto i = 0; i < 4; ++i) {
+        a.emplace_back(new int(i));
+    }
+    auto it = std::next(a.begin(), 2);
+    auto element = &*it;
+    auto pointee = it->get();
+    b.splice(b.end(), a, it);
+    ASSERT_EQ(3u, a.size());
+    ASSERT_EQ(element, &*b.begin());
+    b.emplace_front(new int(10));
+    b.splice(b.begin(), b, std::next(b.begin()));
+    ASSERT_EQ(element, &*b.begin());
+    ASSERT_EQ(pointee, b.pop(b.begin()).get());
+    ASSERT_EQ(10, *b.at(0));
+    ASSERT_EQ(3, *a.pop_back());
+}
+
+TEST(DoublyLinkedListPoolTest, SplitAtSharesPool) {
+    // a lista de split_at recebe uma cópia do alocador: os nós ficam no
+    // mesmo pool e voltam para ele quando ela é destruída
+    structures::NodePool pool;
+    using PoolList = structures::DoublyLinkedList<int,
+        structures::PoolAllocator<int>>;
+    PoolList list{structures::PoolAllocator<int>{pool}};
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    {
+        auto rest = list.split_at(4u);
+        ASSERT_EQ(10u, pool.used());
+        rest.push_back(10);
+        ASSERT_EQ(11u, pool.used());
+    }
+    ASSERT_EQ(4u, pool.used());
+    ASSERT_EQ(4u, list.size());
+    list.clear();
+    ASSERT_EQ(0u, pool.used());
+}
+
+#if __cplusplus >= 201703L
+TEST(DoublyLinkedListPmrTest, RelinksWithExhaustedResource) {
+    // split_at, merge e splice só religam nós: funcionam com o recurso
+    // esgotado, que recusa qualquer nó novo
+    alignas(std::max_align_t) char buffer[1 << 10];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::DoublyLinkedList<int> list{&resource};
+    auto pushed = 0;
+    try {
+        for (; pushed < 1000; pushed++) {
+            list.push_back(2 * pushed);
+        }
+    } catch (const std::bad_alloc&) {
+    }
+    ASSERT_GT(pushed, 1);
+    ASSERT_LT(pushed, 1000);
+    ASSERT_THROW(list.push_back(-1), std::bad_alloc);
+    auto rest = list.split_at(pushed / 2);
+    ASSERT_EQ(static_cast<std::size_t>(pushed / 2), list.size());
+    list.merge(rest);
+    ASSERT_TRUE(rest.empty());
+    list.splice(0, list, list.size() - 1);
+    ASSERT_EQ(2 * (pushed - 1), list.pop_front());
+    for (auto i = 0; i < pushed - 1; i++) {
+        ASSERT_EQ(2 * i, list.pop_front());
+    }
+    ASSERT_TRUE(list.empty());
+}
+
+#endif
+
+TEST_F(DoublyLinkedListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto& data : list) {
+        ASSERT_EQ(expected++, data);
+        data *= 2;
+    }
+    ASSERT_EQ(10, expected);
+    const auto& const_list = list;
+    auto sum = 0;
+    for (auto data : const_list) {
+        sum += data;
+    }
+    ASSERT_EQ(90, sum);
+    ASSERT_EQ(10, std::distance(list.begin(), list.end()));
+    auto it = std::find(list.begin(), list.end(), 8);
+    ASSERT_EQ(8, *it);
+    structures::DoublyLinkedList<int>::ConstIterator converted = it;
+    ASSERT_EQ(10, *++converted);
+    ASSERT_TRUE(std::find(list.begin(), list.end(), 7) == list.end());
+}
+
+TEST_F(DoublyLinkedListTest, BidirectionalIterators) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(9, *--list.end());
+    std::reverse(list.begin(), list.end());
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(9 - static_cast<int>(i), list.at(i));
+    }
+    auto it = list.end();
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, *--it);
+    }
+    ASSERT_TRUE(it == list.begin());
+}
+
+TEST_F(DoublyLinkedListTest, PositionalAccessMatchesReference) {
+    // mistura acessos sequenciais e aleatórios com inserções e retiradas
+    // para exercitar o dedo e a escolha do extremo mais próximo
+    std::vector<int> reference;
+    for (auto i = 0; i < 64; ++i) {
+        list.push_back(i);
+        reference.push_back(i);
+    }
+    std::srand(7);
+    for (auto step = 0; step < 5000; ++step) {
+        auto index = reference.empty() ? 0u :
+                     static_cast<std::size_t>(std::rand()) % reference.size();
+        switch (std::rand() % 7) {
+        case 0:
+            list.insert(step, index);
+            reference.insert(reference.begin() + index, step);
+            break;
+        case 1:
+            if (!reference.empty()) {
+                ASSERT_EQ(reference[index], list.pop(index));
+                reference.erase(reference.begin() + index);
+            }
+            break;
+        case 2:
+            list.push_front(step);
+            reference.insert(reference.begin(), step);
+            break;
+        case 3:
+            if (!reference.empty()) {
+                ASSERT_EQ(reference.front(), list.pop_front());
+                reference.erase(reference.begin());
+            }
+            break;
+        case 4:
+            if (!reference.empty()) {
+                ASSERT_EQ(reference.back(), list.pop_back());
+                reference.pop_back();
+            }
+            break;
+        default:
+            for (auto i = index; i < reference.size() && i < index + 8; ++i) {
+                ASSERT_EQ(reference[i], list.at(i));
+            }
+        }
+        ASSERT_EQ(reference.size(), list.size());
+    }
+    const auto& const_list = list;
+    for (auto i = reference.size(); i-- > 0;) {
+        ASSERT_EQ(reference[i], const_list.at(i));
+    }
+}
+
+namespace {
+// chave comparada pelo merge; tag só distingue iguais
+struct Keyed {
+    int key;
+    int tag;
+    bool operator>(const Keyed& other) const { return key > other.key; }
+};
+
+template<typename List>
+std::vector<int> contents(const List& container) {
+    return std::vector<int>(container.begin(), container.end());
+}
+}  // namespace
+
+TEST_F(DoublyLinkedListTest, SpliceWholeList) {
+    structures::DoublyLinkedList<int> other;
+    for (auto i = 0; i < 3; ++i) {
+        list.push_back(i);
+        other.push_back(10 + i);
+    }
+    list.splice(1u, other);
+    ASSERT_EQ((std::vector<int>{0, 10, 11, 12, 1, 2}), contents(list));
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(6u, list.size());
+    list.splice(0u, other);  // lista vazia: nada muda
+    ASSERT_EQ(6u, list.size());
+    other.splice(0u, list);
+    ASSERT_EQ((std::vector<int>{0, 10, 11, 12, 1, 2}), contents(other));
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(2, other.pop_back());
+    ASSERT_EQ(0, other.pop_front());
+}
+
+TEST_F(DoublyLinkedListTest, SpliceElementAndRange) {
+    structures::DoublyLinkedList<int> other;
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+        other.push_back(10 + i);
+    }
+    list.splice(5u, other, 0u);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 10}), contents(list));
+    ASSERT_EQ((std::vector<int>{11, 12, 13, 14}), contents(other));
+    list.splice(0u, other, 1u, 3u);
+    ASSERT_EQ((std::vector<int>{12, 13, 0, 1, 2, 3, 4, 10}), contents(list));
+    ASSERT_EQ((std::vector<int>{11, 14}), contents(other));
+    ASSERT_EQ(8u, list.size());
+    ASSERT_EQ(2u, other.size());
+    ASSERT_EQ(10, list.at(7));
+    ASSERT_EQ(14, other.at(1));
+    ASSERT_THROW(list.splice(9u, other, 0u), std::out_of_range);
+    ASSERT_THROW(list.splice(0u, other, 2u), std::out_of_range);
+    ASSERT_THROW(list.splice(0u, other, 1u, 0u), std::out_of_range);
+}
+
+TEST_F(DoublyLinkedListTest, SpliceWithinList) {
+    for (auto i = 0; i < 6; ++i) {
+        list.push_back(i);
+    }
+    list.splice(0u, list, 4u, 6u);
+    ASSERT_EQ((std::vector<int>{4, 5, 0, 1, 2, 3}), contents(list));
+    list.splice(6u, list, 0u);
+    ASSERT_EQ((std::vector<int>{5, 0, 1, 2, 3, 4}), contents(list));
+    list.splice(2u, list, 2u, 4u);  // já está no lugar
+    ASSERT_EQ((std::vector<int>{5, 0, 1, 2, 3, 4}), contents(list));
+    ASSERT_THROW(list.splice(3u, list, 2u, 4u), std::out_of_range);
+    ASSERT_EQ(6u, list.size());
+}
+
+TEST_F(DoublyLinkedListTest, SplitAt) {
+    for (auto i = 0; i < 6; ++i) {
+        list.push_back(i);
+    }
+    auto rest = list.split_at(4u);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), contents(list));
+    ASSERT_EQ((std::vector<int>{4, 5}), contents(rest));
+    auto all = list.split_at(0u);
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(4u, all.size());
+    auto none = all.split_at(4u);
+    ASSERT_TRUE(none.empty());
+    ASSERT_THROW(all.split_at(5u), std::out_of_range);
+    list = std::move(all);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), contents(list));
+    ASSERT_TRUE(all.empty());
+}
+
+TEST_F(DoublyLinkedListTest, MergeIsStable) {
+    structures::DoublyLinkedList<Keyed> first;
+    structures::DoublyLinkedList<Keyed> second;
+    for (auto key : {1, 3, 3, 5, 7}) {
+        first.push_back(Keyed{key, 0});
+    }
+    for (auto key : {0, 3, 4, 7, 8, 9}) {
+        second.push_back(Keyed{key, 1});
+    }
+    first.merge(second);
+    ASSERT_TRUE(second.empty());
+    ASSERT_EQ(11u, first.size());
+    std::vector<int> keys;
+    for (const auto& data : first) {
+        keys.push_back(data.key);
+    }
+    ASSERT_EQ((std::vector<int>{0, 1, 3, 3, 3, 4, 5, 7, 7, 8, 9}), keys);
+    // entre iguais, os desta lista vêm antes dos de other
+    ASSERT_EQ(0, first.at(2).tag);
+    ASSERT_EQ(0, first.at(3).tag);
+    ASSERT_EQ(1, first.at(4).tag);
+    ASSERT_EQ(0, first.at(7).tag);
+    ASSERT_EQ(1, first.at(8).tag);
+    ASSERT_EQ(9, first.pop_back().key);
+    ASSERT_EQ(0, first.pop_front().key);
+
+    structures::DoublyLinkedList<Keyed> empty;
+    empty.merge(first);
+    ASSERT_EQ(9u, empty.size());
+    ASSERT_TRUE(first.empty());
+}
+
+TEST(DoublyLinkedListPoolTest, SpliceRequiresSameAllocator) {
+    structures::NodePool pool;
+    structures::NodePool other_pool;
+    using PoolList = structures::DoublyLinkedList<int,
+        structures::PoolAllocator<int>>;
+    PoolList a{structures::PoolAllocator<int>{pool}};
+    PoolList b{structures::PoolAllocator<int>{pool}};
+    PoolList c{structures::PoolAllocator<int>{other_pool}};
+    for (auto i = 0; i < 4; ++i) {
+        a.push_back(i);
+        c.push_back(i);
+    }
+    b.splice(0u, a, 1u, 3u);
+    ASSERT_EQ(2u, b.size());
+    ASSERT_THROW(b.splice(0u, c), std::invalid_argument);
+    ASSERT_THROW(b.merge(c), std::invalid_argument);
+    b = std::move(c);  // alocadores diferentes: move elemento a elemento
+    ASSERT_EQ(4u, b.size());
+    ASSERT_TRUE(c.empty());
+    ASSERT_EQ(0u, other_pool.used());
+    ASSERT_EQ(6u, pool.used());
+}
+
+TEST_F(DoublyLinkedListTest, SortMatchesReference) {
+    list.sort();
+    ASSERT_TRUE(list.empty());
+    list.push_back(1);
+    list.sort();
+    ASSERT_EQ(1, list.at(0));
+    list.clear();
+    std::srand(11);
+    for (auto n : {2, 3, 7, 64, 100, 1000}) {
+        std::vector<int> reference;
+        for (auto i = 0; i < n; ++i) {
+            reference.push_back(std::rand() % 50);
+            list.push_back(reference.back());
+        }
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        ASSERT_EQ(reference.size(), list.size());
+        ASSERT_TRUE(std::equal(reference.begin(), reference.end(),
+                               list.begin()));
+        // extremos e ligações continuam válidos depois de religar os nós
+        list.push_back(100);
+        list.push_front(-1);
+        ASSERT_EQ(100, list.pop_back());
+        ASSERT_EQ(-1, list.pop_front());
+        ASSERT_EQ(reference.back(), list.pop_back());
+        ASSERT_EQ(reference.front(), list.at(0));
+        list.clear();
+    }
+}
+
+TEST_F(DoublyLinkedListTest, SortIsStable) {
+    structures::DoublyLinkedList<Keyed> keyed;
+    for (auto i = 0; i < 200; ++i) {
+        keyed.push_back(Keyed{(i * 7) % 5, i});
+    }
+    keyed.sort();
+    auto previous = Keyed{-1, -1};
+    for (const auto& data : keyed) {
+        ASSERT_FALSE(previous > data);
+        if (previous.key == data.key) {
+            ASSERT_GT(data.tag, previous.tag);
+        }
+        previous = data;
+    }
+    ASSERT_EQ(200u, keyed.size());
+}
+
+TEST_F(DoublyLinkedListTest, SpliceAndPopByIterator) {
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+    }
+    auto it = std::find(list.begin(), list.end(), 3);
+    list.splice(list.begin(), list, it);
+    ASSERT_EQ((std::vector<int>{3, 0, 1, 2, 4}), contents(list));
+    ASSERT_EQ(3, *it);  // o iterador continua no mesmo nó
+    list.splice(list.end(), list, it);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 4, 3}), contents(list));
+    list.splice(list.end(), list, it);  // já está no lugar
+    ASSERT_EQ(3, list.at(4));
+    ASSERT_EQ(1, list.pop(std::next(list.begin())));
+    ASSERT_EQ(3, list.pop(--list.end()));
+    ASSERT_EQ((std::vector<int>{0, 2, 4}), contents(list));
+    ASSERT_EQ(4, list.pop_back());
+    ASSERT_EQ(0, list.pop(list.begin()));
+    ASSERT_EQ(2, list.at(0));
+    ASSERT_THROW(list.pop(list.end()), std::out_of_range);
+}
@@ -1,29 +1,125 @@
 //! Copyright [2021] Gabriel de Vargas Coelho
-#ifndef STRUCTURES_LINKED_LIST_H
-#define STRUCTURES_LINKED_LIST_H
+#ifndef STRUCTURES_CIRCULAR_LIST_H
+#define STRUCTURES_CIRCULAR_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
 //! Classe lista encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class CircularList {
+ private:
+    class Node;
+
  public:
+    //! Iterador para frente; Value é T ou const T
+    template<typename Value>
+    class BasicIterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::remove_const<Value>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        //! Iterador nulo
+        BasicIterator() = default;
+        //! Converte Iterator em ConstIterator
+        template<typename Other, typename = typename std::enable_if<
+            std::is_same<const Other, Value>::value>::type>
+        BasicIterator(const BasicIterator<Other>& other):  // NOLINT
+            node_{other.node_}
+        {}
+        //! Elemento atual
+        reference operator*() const {
+            return node_->data();
+        }
+        //! Elemento atual
+        pointer operator->() const {
+            return &node_->data();
+        }
+        //! Avança para o próximo elemento
+        BasicIterator& operator++() {
+            node_ = node_->next();
+            return *this;
+        }
+        //! Avança para o próximo elemento
+        BasicIterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+        //! Compara posições
+        bool operator==(const BasicIterator& other) const {
+            return node_ == other.node_;
+        }
+        //! Compara posições
+        bool operator!=(const BasicIterator& other) const {
+            return !(*this == other);
+        }
+
+     private:
+        friend class CircularList;
+        template<typename> friend class BasicIterator;
+        //! Node* ou const Node*
+        using NodePointer = typename std::conditional<
+            std::is_const<Value>::value, const Node*, Node*>::type;
+        //! Iterador no nó node (ref: fim)
+        explicit BasicIterator(NodePointer node):
+            node_{node}
+        {}
+        //! Nó atual
+        NodePointer node_{nullptr};
+    };
+    //! Iterador para frente
+    using Iterator = BasicIterator<T>;
+    //! Iterador para frente, só leitura
+    using ConstIterator = BasicIterator<const T>;
+
     //! Construtor
     CircularList();  // construtor padrão
+    //! Construtor, nós reservados com allocator
+    explicit CircularList(const Allocator& allocator);
     //! Destrutor
     ~CircularList();  // destrutor
     //! Limpa a lista
     void clear();  // limpar lista
     //! Insere no fim
     void push_back(const T& data);  // inserir no fim
+    //! Insere no fim, movendo o dado
+    void push_back(T&& data);
     //! Insere no início
     void push_front(const T& data);  // inserir no início
+    //! Insere no início, movendo o dado
+    void push_front(T&& data);
     //! Insere na posição
     void insert(const T& data, std::size_t index);  // inserir na posição
+    //! Insere na posição, movendo o dado
+    void insert(T&& data, std::size_t index);
     //! Insere na ordem
     void insert_sorted(const T& data);  // inserir em ordem
+    //! Insere na ordem, movendo o dado
+    void insert_sorted(T&& data);
+    //! Constrói no fim
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+    //! Constrói no início
+    template<typename... Args>
+    void emplace_front(Args&&... args);
+    //! Constrói na posição
+    template<typename... Args>
+    void emplace(std::size_t index, Args&&... args);
     //! Acessa na posição
     T& at(std::size_t index);  // acessar um elemento na posição index
     //! Retira da posição
@@ -42,19 +138,29 @@ class CircularList {
     std::size_t find(const T& data) const;  // posição do data
     //! Tamanho da lista
     std::size_t size() const;  // tamanho da lista
+    //! Ordena a lista: merge sort estável que religa os nós, sem alocar
+    void sort();
+    //! Primeiro elemento
+    Iterator begin();
+    //! Depois do último elemento
+    Iterator end();
+    //! Primeiro elemento, só leitura
+    ConstIterator begin() const;
+    //! Depois do último elemento, só leitura
+    ConstIterator end() const;
+    //! Primeiro elemento, só leitura
+    ConstIterator cbegin() const;
+    //! Depois do último elemento, só leitura
+    ConstIterator cend() const;
 
  private:
     //! Elemento
     class Node {  // Elemento
      public:
-        //! Construtor
-        explicit Node(const T& data):
-            data_{data}
-        {}
-        //! Construtor parametrizado
-        Node(const T& data, Node* next):
-            data_{data},
-            next_{next}
+        //! Construtor, dado construído no lugar
+        template<typename... Args>
+        explicit Node(Args&&... args):
+            data_(std::forward<Args>(args)...)
         {}
         //! Acessa data
         T& data() {  // getter: data
@@ -83,41 +189,77 @@ class CircularList {
         //! Próximo elemento
         Node* next_{nullptr};
     };
+    //! Alocador de nós
+    using NodeAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    //! Operações do alocador de nós
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    //! Reserva e constrói um nó
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    //! Destrói e devolve um nó
+    void destroy_node(Node* node);
+    //! Ordena a cadeia chain terminada em nullptr; devolve o primeiro nó
+    static Node* merge_sort(Node* chain);
+    //! Intercala as cadeias ordenadas left e right; iguais de left antes
+    static Node* merge_chains(Node* left, Node* right);
+    //! Reserva os nós
+    NodeAllocator allocator_;
     //! Último elemento da lista
-    Node* end() {  // último nodo da lista
+    Node* last_node() {  // último nodo da lista
         auto it = head;
         for (auto i = 1u; i < size(); ++i) {
             it = it->next();
         }
         return it;
     }
-    Node* ref{new Node(0)};
+    Node* ref{create_node()};
     //! Primeiro elemento da lista
     Node* head{nullptr};
     //! Tamanho da lista
     std::size_t size_{0u};
 };
 
-}  // namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! CircularList com nós em um std::pmr::memory_resource
 template<typename T>
-structures::CircularList<T>::CircularList() {
+using CircularList =
+    structures::CircularList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList() {
     size_ = 0;
     head = nullptr;
 }
 
-template<typename T>
-structures::CircularList<T>::~CircularList() {
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(
+    const Allocator& allocator):
+    allocator_{allocator}
+{
+    size_ = 0;
+    head = nullptr;
+}
+
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::~CircularList() {
     clear();
-    delete ref;
+    destroy_node(ref);
 }
 
-template<typename T>
-void structures::CircularList<T>::clear() {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::clear() {
     Node* current = head;
     while (current != ref && current != nullptr) {
         auto next = current->next();
-        delete current;
+        destroy_node(current);
         current = next;
     }
     head = nullptr;
@@ -125,48 +267,112 @@ void structures::CircularList<T>::clear() {
     ref->next(nullptr);
 }
 
-template<typename T>
-void structures::CircularList<T>::push_back(const T& data) {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert(
+    const T& data, std::size_t index) {
+    emplace(index, data);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert(
+    T&& data, std::size_t index) {
+    emplace(index, std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert_sorted(const T& data) {
+    insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert_sorted(T&& data) {
     if (size() == 0) {
-        return push_front(data);
+        return push_front(std::move(data));
     }
-    Node* element = new Node(data, ref);
+    auto current = head;
+    auto pos = 0u;
+    while (
+        current->next() != nullptr &&
+        current->next() != ref &&
+        data > current->data()
+    ) {
+        current = current->next();
+        pos++;
+    }
+    if (data > current->data()) {
+        return insert(std::move(data), pos + 1);
+    } else {
+        return insert(std::move(data), pos);
+    }
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::CircularList<T, Allocator>::emplace_back(Args&&... args) {
+    if (size() == 0) {
+        return emplace_front(std::forward<Args>(args)...);
+    }
+    Node* element = create_node(std::forward<Args>(args)...);
     if (element == nullptr) {
         throw std::out_of_range("Lista cheia");
     }
-    auto last = end();
+    element->next(ref);
+    auto last = last_node();
     last->next(element);
     size_ += 1;
 }
 
-template<typename T>
-void structures::CircularList<T>::push_front(const T& data) {
-    Node* element;
-    if (size() == 0) {
-        element = new Node(data, ref);
-    } else {
-        element = new Node(data, head);
-    }
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::CircularList<T, Allocator>::emplace_front(Args&&... args) {
+    Node* element = create_node(std::forward<Args>(args)...);
     if (element == nullptr) {
         throw std::out_of_range("Lista cheia");
     }
+    if (size() == 0) {
+        element->next(ref);
+    } else {
+        element->next(head);
+    }
     head = element;
     ref->next(head);
     size_ += 1;
 }
 
-template<typename T>
-void structures::CircularList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::CircularList<T, Allocator>::emplace(
+    std::size_t index, Args&&... args) {
     if (index > size()) {
         throw std::out_of_range("Índice fora do limite");
     }
     if (index == 0) {
-        return push_front(data);
+        return emplace_front(std::forward<Args>(args)...);
     }
     if (index == size()) {
-        return push_back(data);
+        return emplace_back(std::forward<Args>(args)...);
     }
-    Node* element = new Node(data);
+    Node* element = create_node(std::forward<Args>(args)...);
     if (element == nullptr) {
         throw std::out_of_range("Lista cheia");
     }
@@ -181,30 +387,8 @@ void structures::CircularList<T>::insert(const T& data, std::size_t index) {
     size_++;
 }
 
-template<typename T>
-void structures::CircularList<T>::insert_sorted(const T& data) {
-    if (size() == 0) {
-        return push_front(data);
-    }
-    auto current = head;
-    auto pos = 0u;
-    while (
-        current->next() != nullptr &&
-        current->next() != ref &&
-        data > current->data()
-    ) {
-        current = current->next();
-        pos++;
-    }
-    if (data > current->data()) {
-        return insert(data, pos + 1);
-    } else {
-        return insert(data, pos);
-    }
-}
-
-template<typename T>
-T& structures::CircularList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::CircularList<T, Allocator>::at(std::size_t index) {
     if (index > size() - 1) {
         throw std::out_of_range("Índice fora do limite");
     }
@@ -215,8 +399,8 @@ T& structures::CircularList<T>::at(std::size_t index) {
     return current->data();
 }
 
-template<typename T>
-T structures::CircularList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("Lista vazia");
     }
@@ -234,22 +418,22 @@ T structures::CircularList<T>::pop(std::size_t index) {
         previous = previous->next();
     }
     auto exclude = previous->next();
-    auto data = exclude->data();
+    auto data = std::move(exclude->data());
     previous->next(exclude->next());
     size_--;
-    delete exclude;
+    destroy_node(exclude);
     return data;
 }
 
-template<typename T>
-T structures::CircularList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop_back() {
     if (empty()) {
         throw std::out_of_range("Lista vazia");
     }
     if (size() == 1) {
         auto aux = head;
-        auto data = aux->data();
-        delete aux;
+        auto data = std::move(aux->data());
+        destroy_node(aux);
         head = nullptr;
         ref->next(nullptr);
         size_--;
@@ -260,29 +444,29 @@ T structures::CircularList<T>::pop_back() {
         previous = previous->next();
     }
     auto exclude = previous->next();
-    auto data = exclude->data();
+    auto data = std::move(exclude->data());
     previous->next(ref);
     size_--;
-    delete exclude;
+    destroy_node(exclude);
     return data;
 }
 
-template<typename T>
-T structures::CircularList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("Lista vazia");
     }
     auto previous_head = head;
-    auto data = previous_head->data();
+    auto data = std::move(previous_head->data());
     head = previous_head->next();
     ref->next(head);
     size_--;
-    delete previous_head;
+    destroy_node(previous_head);
     return data;
 }
 
-template<typename T>
-void structures::CircularList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::remove(const T& data) {
     auto current = head;
     for (auto i = 0u; i < size(); i++) {
         if (data == current->data()) {
@@ -293,13 +477,13 @@ void structures::CircularList<T>::remove(const T& data) {
     }
 }
 
-template<typename T>
-bool structures::CircularList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::CircularList<T, Allocator>::empty() const {
     return size_ == 0;
 }
 
-template<typename T>
-bool structures::CircularList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::CircularList<T, Allocator>::contains(const T& data) const {
     auto current = head;
     for (auto i = 0u; i < size(); i++) {
         if (data == current->data()) {
@@ -310,8 +494,8 @@ bool structures::CircularList<T>::contains(const T& data) const {
     return false;
 }
 
-template<typename T>
-std::size_t structures::CircularList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::CircularList<T, Allocator>::find(const T& data) const {
     auto current = head;
     for (auto i = 0u; i < size(); i++) {
         if (data == current->data()) {
@@ -322,9 +506,139 @@ std::size_t structures::CircularList<T>::find(const T& data) const {
     return size();
 }
 
-template<typename T>
-std::size_t structures::CircularList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::CircularList<T, Allocator>::size() const {
     return size_;
 }
 
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::sort() {
+    if (size() < 2u) {
+        return;
+    }
+    // abre o círculo antes de ordenar e fecha pelo sentinela depois
+    last_node()->next(nullptr);
+    head = merge_sort(head);
+    ref->next(head);
+    last_node()->next(ref);
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::Node*
+structures::CircularList<T, Allocator>::merge_sort(Node* chain) {
+    // de baixo para cima: bins[k] guarda uma sequência ordenada de 2^k nós
+    // (ou nenhuma); cada nó entra como sequência de um e sobe intercalando,
+    // enquanto as sequências curtas ainda estão em cache
+    Node* bins[std::numeric_limits<std::size_t>::digits] = {};
+    auto used = 0u;
+    while (chain != nullptr) {
+        auto carry = chain;
+        chain = chain->next();
+        carry->next(nullptr);
+        auto k = 0u;
+        for (; k < used && bins[k] != nullptr; k++) {
+            // bins[k] veio antes na lista: fica à esquerda
+            carry = merge_chains(bins[k], carry);
+            bins[k] = nullptr;
+        }
+        if (k == used) {
+            used++;
+        }
+        bins[k] = carry;
+    }
+    Node* sorted = nullptr;
+    for (auto k = 0u; k < used; k++) {
+        sorted = merge_chains(bins[k], sorted);
+    }
+    return sorted;
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::Node*
+structures::CircularList<T, Allocator>::merge_chains(
+    Node* left, Node* right) {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    Node* first = nullptr;
+    Node* last = nullptr;
+    while (left != nullptr && right != nullptr) {
+        Node* next;
+        if (left->data() > right->data()) {
+            next = right;
+            right = right->next();
+        } else {
+            next = left;
+            left = left->next();
+        }
+        if (last == nullptr) {
+            first = next;
+        } else {
+            last->next(next);
+        }
+        last = next;
+    }
+    last->next(left != nullptr ? left : right);
+    return first;
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::Iterator
+structures::CircularList<T, Allocator>::begin() {
+    return Iterator(size() == 0 ? ref : head);
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::Iterator
+structures::CircularList<T, Allocator>::end() {
+    return Iterator(ref);
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::ConstIterator
+structures::CircularList<T, Allocator>::begin() const {
+    return ConstIterator(size() == 0 ? ref : head);
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::ConstIterator
+structures::CircularList<T, Allocator>::end() const {
+    return ConstIterator(ref);
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::ConstIterator
+structures::CircularList<T, Allocator>::cbegin() const {
+    return begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::ConstIterator
+structures::CircularList<T, Allocator>::cend() const {
+    return end();
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::CircularList<T, Allocator>::Node*
+structures::CircularList<T, Allocator>::create_node(Args&&... args) {
+    auto node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
 #endif
@@ -2,6 +2,17 @@
 
 #include "gtest/gtest.h"
 #include "./circular_list.h"
+#include "../lista-encadeada/node_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -215,3 +226,172 @@ TEST_F(CircularListTest, RemoveElement) {
     ASSERT_EQ(9u, list.size());
     ASSERT_FALSE(list.contains(4));
 }
+
+TEST(CircularListMoveTest, RotateMoveOnly) {
+    // pop_front e push_back passam pelo sentinela: o unique_ptr sai de um
+    // nó e entra no outro sem cópia, apontando para o mesmo objeto
+    structures::CircularList<std::unique_ptr<int>> list{};
+    std::vector<int*> raw;
+    for (auto i = 0; i < 5; ++i) {
+        raw.push_back(new int(i));
+        list.emplace_back(raw.back());
+    }
+    for (auto i = 0; i < 12; ++i) {
+        list.push_back(list.pop_front());
+    }
+    auto i = 0;
+    for (const auto& data : list) {
+        ASSERT_EQ(raw[(i++ + 12) % 5], data.get());
+    }
+    ASSERT_EQ(5, i);
+}
+
+TEST(CircularListPoolTest, SentinelFromPool) {
+    // o sentinela também é um bloco do pool: reservado no construtor,
+    // mantido por clear e devolvido só no destrutor
+    structures::NodePool pool;
+    {
+        structures::PoolAllocator<std::string> allocator{pool};
+        structures::CircularList<std::string,
+            structures::PoolAllocator<std::string>> container{allocator};
+        ASSERT_EQ(1u, pool.used());
+        for (auto i = 0; i < 10; i++) {
+            container.push_back(std::to_string(i));
+        }
+        ASSERT_EQ(11u, pool.used());
+        container.clear();
+        ASSERT_EQ(1u, pool.used());
+        container.push_front("a");
+        ASSERT_EQ("a", *container.begin());
+        ASSERT_EQ(2u, pool.used());
+    }
+    ASSERT_EQ(0u, pool.used());
+}
+
+#if __cplusplus >= 201703L
+TEST(CircularListPmrTest, SentinelFromResource) {
+    // o sentinela sai do recurso no construtor: sem memória nem a lista
+    // vazia existe
+    ASSERT_THROW(structures::pmr::CircularList<int> empty{
+                     std::pmr::null_memory_resource()}, std::bad_alloc);
+    alignas(std::max_align_t) char buffer[1 << 10];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::CircularList<int> container{&resource};
+    auto pushed = 0;
+    try {
+        for (; pushed < 1000; pushed++) {
+            container.push_front(pushed);
+        }
+    } catch (const std::bad_alloc&) {
+    }
+    ASSERT_GT(pushed, 0);
+    ASSERT_LT(pushed, 1000);
+    // o push_front que falhou não mexeu em head: o anel ainda fecha no
+    // sentinela
+    auto expected = pushed;
+    for (auto data : container) {
+        ASSERT_EQ(--expected, data);
+    }
+    ASSERT_EQ(0, expected);
+    container.clear();
+    ASSERT_TRUE(container.begin() == container.end());
+}
+
+#endif
+
+TEST_F(CircularListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto& data : list) {
+        ASSERT_EQ(expected++, data);
+        data *= 2;
+    }
+    ASSERT_EQ(10, expected);
+    const auto& const_list = list;
+    auto sum = 0;
+    for (auto data : const_list) {
+        sum += data;
+    }
+    ASSERT_EQ(90, sum);
+    ASSERT_EQ(10, std::distance(list.begin(), list.end()));
+    auto it = std::find(list.begin(), list.end(), 8);
+    ASSERT_EQ(8, *it);
+    structures::CircularList<int>::ConstIterator converted = it;
+    ASSERT_EQ(10, *++converted);
+    ASSERT_TRUE(std::find(list.begin(), list.end(), 7) == list.end());
+}
+
+TEST_F(CircularListTest, IteratorsAfterChanges) {
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+    }
+    list.pop_back();
+    list.push_front(-1);
+    list.insert(10, 2);
+    std::vector<int> contents(list.begin(), list.end());
+    ASSERT_EQ((std::vector<int>{-1, 0, 10, 1, 2, 3}), contents);
+    while (!list.empty()) {
+        list.pop_front();
+    }
+    ASSERT_TRUE(list.begin() == list.end());
+}
+
+namespace {
+// chave comparada pela ordenação; tag só distingue iguais
+struct Keyed {
+    int key;
+    int tag;
+    bool operator>(const Keyed& other) const { return key > other.key; }
+};
+}  // namespace
+
+TEST_F(CircularListTest, SortMatchesReference) {
+    list.sort();
+    ASSERT_TRUE(list.empty());
+    list.push_back(1);
+    list.sort();
+    ASSERT_EQ(1, list.at(0));
+    list.clear();
+    std::srand(11);
+    for (auto n : {2, 3, 7, 64, 100, 1000}) {
+        std::vector<int> reference;
+        for (auto i = 0; i < n; ++i) {
+            reference.push_back(std::rand() % 50);
+            list.push_back(reference.back());
+        }
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        ASSERT_EQ(reference.size(), list.size());
+        ASSERT_TRUE(std::equal(reference.begin(), reference.end(),
+                               list.begin()));
+        // extremos e ligações continuam válidos depois de religar os nós
+        list.push_back(100);
+        list.push_front(-1);
+        ASSERT_EQ(100, list.pop_back());
+        ASSERT_EQ(-1, list.pop_front());
+        ASSERT_EQ(reference.back(), list.pop_back());
+        ASSERT_EQ(reference.front(), list.at(0));
+        list.clear();
+    }
+}
+
+TEST_F(CircularListTest, SortIsStable) {
+    structures::CircularList<Keyed> keyed;
+    for (auto i = 0; i < 200; ++i) {
+        keyed.push_back(Keyed{(i * 7) % 5, i});
+    }
+    keyed.sort();
+    auto previous = Keyed{-1, -1};
+    for (const auto& data : keyed) {
+        ASSERT_FALSE(previous > data);
+        if (previous.key == data.key) {
+            ASSERT_GT(data.tag, previous.tag);
+        }
+        previous = data;
+    }
+    ASSERT_EQ(200u, keyed.size());
+}
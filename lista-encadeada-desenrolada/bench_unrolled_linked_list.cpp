@@ -0,0 +1,84 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de LinkedList, UnrolledLinkedList e ArrayList em cargas mistas.
+// Compilar: g++ -O2 -std=c++14 -pthread bench_unrolled_linked_list.cpp
+//           -o bench_unrolled_linked_list
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "unrolled_linked_list.h"
+#include "../lista-encadeada/linked_list.h"
+#include "../lista-vetor/array_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+const unsigned OPERATIONS = 2000u;
+
+//! Tempos (ms) das cargas sobre uma lista com n elementos
+template<typename List>
+void run(const char* name, List& list, unsigned n) {
+  long long checksum = 0;
+  auto build = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      list.push_back(static_cast<int>(i));
+    }
+  });
+  std::srand(42);
+  auto find = measure([&] {
+    for (auto i = 0u; i < OPERATIONS; i++) {
+      checksum += list.find(std::rand() % n);
+    }
+  });
+  auto at = measure([&] {
+    for (auto i = 0u; i < OPERATIONS; i++) {
+      checksum += list.at(std::rand() % n);
+    }
+  });
+  auto insert = measure([&] {
+    for (auto i = 0u; i < OPERATIONS; i++) {
+      list.insert(static_cast<int>(i), std::rand() % list.size());
+    }
+  });
+  // 70% busca, 15% inserção e 15% retirada em posições aleatórias
+  auto mixed = measure([&] {
+    for (auto i = 0u; i < OPERATIONS; i++) {
+      auto operation = std::rand() % 20;
+      if (operation < 14) {
+        checksum += list.find(std::rand() % n);
+      } else if (operation < 17) {
+        list.insert(static_cast<int>(i), std::rand() % list.size());
+      } else {
+        checksum += list.pop(std::rand() % list.size());
+      }
+    }
+  });
+  std::printf("  %-20s push_back %8.2f  find %8.2f  at %8.2f  insert %8.2f"
+              "  misto %8.2f  (%lld)\n", name, build, find, at, insert, mixed,
+              checksum);
+}
+
+int main() {
+  std::printf("%u operações por carga, tempos em ms\n", OPERATIONS);
+  for (auto n : {10000u, 100000u, 1000000u}) {
+    std::printf("n=%u\n", n);
+    {
+      structures::LinkedList<int> list;
+      run("LinkedList", list, n);
+    }
+    {
+      structures::UnrolledLinkedList<int> list;
+      run("UnrolledLinkedList", list, n);
+    }
+    {
+      structures::ArrayList<int> list(n + 2 * OPERATIONS);
+      run("ArrayList", list, n);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,248 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#include "gtest/gtest.h"
+#include "unrolled_linked_list.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+class UnrolledLinkedListTest: public ::testing::Test {
+protected:
+    // nós pequenos: os testes passam por divisões e junções
+    structures::UnrolledLinkedList<int, 4> list{};
+};
+
+TEST_F(UnrolledLinkedListTest, PushBack) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(10u, list.size());
+    ASSERT_EQ(3u, list.nodes());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list.at(i));
+    }
+    ASSERT_THROW(list.at(10), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, PushFront) {
+    for (auto i = 9; i >= 0; --i) {
+        list.push_front(i);
+    }
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list.at(i));
+    }
+}
+
+TEST_F(UnrolledLinkedListTest, EmptyAccess) {
+    ASSERT_TRUE(list.empty());
+    ASSERT_THROW(list.at(0), std::out_of_range);
+    ASSERT_THROW(list.pop_back(), std::out_of_range);
+    ASSERT_THROW(list.pop_front(), std::out_of_range);
+    ASSERT_THROW(list.pop(0), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, Insert) {
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+    }
+    for (auto i = 6; i < 10; ++i) {
+        list.push_back(i);
+    }
+    list.insert(5, 5u);
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list.at(i));
+    }
+    ASSERT_THROW(list.insert(11, 11u), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, InsertInOrder) {
+    for (auto i = 9; i >= 0; --i) {
+        list.insert_sorted(i);
+    }
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list.at(i));
+    }
+    list.clear();
+    ASSERT_EQ(0u, list.nodes());
+    list.insert_sorted(10);
+    list.insert_sorted(-10);
+    list.insert_sorted(42);
+    list.insert_sorted(0);
+    ASSERT_EQ(-10, list.at(0));
+    ASSERT_EQ(0, list.at(1));
+    ASSERT_EQ(10, list.at(2));
+    ASSERT_EQ(42, list.at(3));
+}
+
+TEST_F(UnrolledLinkedListTest, PopAndMerge) {
+    for (auto i = 0; i < 8; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(2u, list.nodes());
+    ASSERT_EQ(4, list.pop(4));
+    ASSERT_EQ(1, list.pop(1));
+    ASSERT_EQ(2, list.pop(1));
+    ASSERT_EQ(2u, list.nodes());
+    // o primeiro nó ficou com um elemento e cabe junto com o segundo
+    ASSERT_EQ(3, list.pop(1));
+    ASSERT_EQ(1u, list.nodes());
+    ASSERT_EQ(7, list.pop_back());
+    ASSERT_EQ(0, list.pop_front());
+    ASSERT_EQ(5, list.pop_front());
+    ASSERT_EQ(6, list.pop_back());
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(0u, list.nodes());
+}
+
+TEST_F(UnrolledLinkedListTest, FindAndRemove) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(7u, list.find(7));
+    ASSERT_EQ(list.size(), list.find(42));
+    list.remove(4);
+    ASSERT_EQ(9u, list.size());
+    ASSERT_FALSE(list.contains(4));
+    ASSERT_EQ(6u, list.find(7));
+    list.remove(42);
+    ASSERT_EQ(9u, list.size());
+}
+
+TEST(UnrolledLinkedListReferenceTest, MatchesVector) {
+    // operações aleatórias comparadas com std::vector
+    std::srand(42);
+    structures::UnrolledLinkedList<int, 8> list;
+    std::vector<int> reference;
+    for (auto step = 0; step < 20000; ++step) {
+        auto value = std::rand() % 100;
+        auto operation = std::rand() % 6;
+        if (operation == 0 || reference.empty()) {
+            auto index = std::rand() % (reference.size() + 1);
+            list.insert(value, index);
+            reference.insert(reference.begin() + index, value);
+        } else if (operation == 1) {
+            list.push_back(value);
+            reference.push_back(value);
+        } else if (operation == 2) {
+            auto index = std::rand() % reference.size();
+            ASSERT_EQ(reference[index], list.pop(index));
+            reference.erase(reference.begin() + index);
+        } else if (operation == 3) {
+            ASSERT_EQ(reference.front(), list.pop_front());
+            reference.erase(reference.begin());
+        } else if (operation == 4) {
+            auto it = std::find(reference.begin(), reference.end(), value);
+            ASSERT_EQ(static_cast<std::size_t>(it - reference.begin()),
+                      list.find(value));
+        } else {
+            list.remove(value);
+            auto it = std::find(reference.begin(), reference.end(), value);
+            if (it != reference.end()) {
+                reference.erase(it);
+            }
+        }
+        ASSERT_EQ(reference.size(), list.size());
+    }
+    for (auto i = 0u; i < reference.size(); ++i) {
+        ASSERT_EQ(reference[i], list.at(i));
+    }
+    // junções mantêm os nós ao menos um quarto cheios, em média
+    ASSERT_LE(list.nodes(), reference.size() / 2 + 1);
+}
+
+TEST(UnrolledLinkedListMoveTest, SplitAndJoinMoveStrings) {
+    // split leva a metade final do nó cheio para um nó novo, e erase junta
+    // o seguinte de volta: as strings passam por movimento, com o buffer
+    structures::UnrolledLinkedList<std::string, 4> list{};
+    std::vector<const char*> buffers;
+    for (auto i = 0; i < 4; ++i) {
+        list.emplace_back(40u, static_cast<char>('a' + i));
+        buffers.push_back(list.at(i).data());
+    }
+    ASSERT_EQ(1u, list.nodes());
+    list.emplace(1u, 40u, 'x');
+    ASSERT_EQ(2u, list.nodes());
+    ASSERT_EQ(buffers[0], list.at(0).data());
+    ASSERT_EQ(buffers[1], list.at(2).data());
+    ASSERT_EQ(buffers[2], list.at(3).data());
+    ASSERT_EQ(buffers[3], list.at(4).data());
+    ASSERT_EQ(std::string(40u, 'x'), list.pop(1u));
+    ASSERT_EQ(buffers[0], list.pop(0u).data());
+    ASSERT_EQ(1u, list.nodes());
+    for (auto i = 0u; i < 3u; ++i) {
+        ASSERT_EQ(buffers[i + 1], list.at(i).data());
+    }
+}
+
+TEST(UnrolledLinkedListMoveTest, SplitTailMoveOnly) {
+    // emplace_back no último nó cheio o divide: tail passa ao nó novo e
+    // os unique_ptr chegam lá sem cópia
+    structures::UnrolledLinkedList<std::unique_ptr<int>, 2> list{};
+    std::vector<int*> raw;
+    for (auto i = 0; i < 5; ++i) {
+        raw.push_back(new int(i));
+        list.emplace_back(raw.back());
+    }
+    ASSERT_GT(list.nodes(), 2u);
+    for (auto i = 0u; i < 5u; ++i) {
+        ASSERT_EQ(raw[i], list.at(i).get());
+    }
+    ASSERT_EQ(raw[4], list.pop_back().get());
+    ASSERT_EQ(raw[0], list.pop_front().get());
+    ASSERT_EQ(3u, list.size());
+}
+
+TEST(UnrolledLinkedListCapacityTest, DefaultCapacity) {
+    // nós de dois blocos de cache (128 bytes), com ao menos 4 elementos
+    ASSERT_EQ(28u, structures::unrolled_capacity(sizeof(int)));
+    ASSERT_EQ(14u, structures::unrolled_capacity(sizeof(double)));
+    ASSERT_EQ(4u, structures::unrolled_capacity(64u));
+}
+
+#if __cplusplus >= 201703L
+TEST(UnrolledLinkedListPmrTest, MonotonicBuffer) {
+    alignas(std::max_align_t) char buffer[1 << 14];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::UnrolledLinkedList<int> list{&resource};
+    for (auto i = 0; i < 1000; i++) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(999u, list.find(999));
+}
+#endif
+
+TEST_F(UnrolledLinkedListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    std::vector<int> reference;
+    for (auto i = 0; i < 50; ++i) {
+        list.push_back(i);
+        reference.push_back(i);
+    }
+    // deixa nós parcialmente ocupados
+    for (auto i = 0; i < 10; ++i) {
+        list.pop(3 * i);
+        reference.erase(reference.begin() + 3 * i);
+    }
+    ASSERT_EQ(reference, std::vector<int>(list.begin(), list.end()));
+    for (auto& data : list) {
+        data += 1;
+    }
+    const auto& const_list = list;
+    ASSERT_EQ(std::accumulate(reference.begin(), reference.end(), 0) + 40,
+              std::accumulate(const_list.begin(), const_list.end(), 0));
+    structures::UnrolledLinkedList<int, 4>::ConstIterator it =
+        std::find(list.begin(), list.end(), reference[20] + 1);
+    ASSERT_EQ(20, std::distance(const_list.begin(), it));
+}
@@ -0,0 +1,656 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_UNROLLED_LINKED_LIST_H
+#define STRUCTURES_UNROLLED_LINKED_LIST_H
+
+#include <algorithm>  // std::move, std::move_backward
+#include <cstddef>  // std::ptrdiff_t
+#include <cstdint>
+#include <iterator>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+#include "../lista-vetor/simd_find.h"
+
+namespace structures {
+
+//! elementos de tamanho element por nó, para nós de cerca de bytes bytes
+constexpr std::size_t unrolled_capacity(std::size_t element,
+                                        std::size_t bytes = 128u) {
+  // o nó guarda também o próximo e a quantidade; ao menos 4 elementos
+  return 4 * element + 2 * sizeof(void*) > bytes ?
+         4u : (bytes - 2 * sizeof(void*)) / element;
+}
+
+template<typename T, std::size_t N = unrolled_capacity(sizeof(T)),
+         typename Allocator = std::allocator<T>>
+//! Lista encadeada desenrolada: cada nó guarda até N elementos em vetor
+/*!
+  Mesma interface de LinkedList. Percorrer a lista visita um nó a cada
+  N elementos, e a busca dentro do nó é a mesma de ArrayList (vetorizada
+  para tipos aritméticos). Inserir em um nó cheio o divide ao meio;
+  retirar junta o nó com o seguinte quando os dois cabem em um só.
+*/
+class UnrolledLinkedList {
+ private:
+  struct Node;
+
+ public:
+  static_assert(N > 1, "UnrolledLinkedList requer N > 1");
+
+  //! iterador para frente; Value é T ou const T
+  template<typename Value>
+  class BasicIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<Value>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    //! iterador nulo
+    BasicIterator() = default;
+    //! converte Iterator em ConstIterator
+    template<typename Other, typename = typename std::enable_if<
+        std::is_same<const Other, Value>::value>::type>
+    BasicIterator(const BasicIterator<Other>& other):  // NOLINT
+      node_{other.node_},
+      offset_{other.offset_}
+    {}
+    //! elemento atual
+    reference operator*() const {
+      return node_->data[offset_];
+    }
+    //! elemento atual
+    pointer operator->() const {
+      return &node_->data[offset_];
+    }
+    //! avança para o próximo elemento, passando ao próximo nó no fim
+    BasicIterator& operator++() {
+      if (++offset_ == node_->count) {
+        node_ = node_->next;
+        offset_ = 0;
+      }
+      return *this;
+    }
+    //! avança para o próximo elemento
+    BasicIterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+    //! compara posições
+    bool operator==(const BasicIterator& other) const {
+      return node_ == other.node_ && offset_ == other.offset_;
+    }
+    //! compara posições
+    bool operator!=(const BasicIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class UnrolledLinkedList;
+    template<typename> friend class BasicIterator;
+    //! Node* ou const Node*
+    using NodePointer = typename std::conditional<
+        std::is_const<Value>::value, const Node*, Node*>::type;
+    //! iterador no elemento offset de node (nullptr: fim)
+    BasicIterator(NodePointer node, std::size_t offset):
+      node_{node},
+      offset_{offset}
+    {}
+    //! nó atual
+    NodePointer node_{nullptr};
+    //! posição no nó atual
+    std::size_t offset_{0u};
+  };
+  //! iterador para frente
+  using Iterator = BasicIterator<T>;
+  //! iterador para frente, só leitura
+  using ConstIterator = BasicIterator<const T>;
+
+  //! construtor
+  UnrolledLinkedList();
+  //! construtor, nós reservados com allocator
+  explicit UnrolledLinkedList(const Allocator& allocator);
+  //! não copiável
+  UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+  //! não copiável
+  UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+  //! destrutor
+  ~UnrolledLinkedList();
+  //! limpa a lista
+  void clear();
+  //! insere no fim
+  void push_back(const T& data);
+  //! insere no fim, movendo o dado
+  void push_back(T&& data);
+  //! insere no início
+  void push_front(const T& data);
+  //! insere no início, movendo o dado
+  void push_front(T&& data);
+  //! insere na posição
+  void insert(const T& data, std::size_t index);
+  //! insere na posição, movendo o dado
+  void insert(T&& data, std::size_t index);
+  //! insere na ordem
+  void insert_sorted(const T& data);
+  //! insere na ordem, movendo o dado
+  void insert_sorted(T&& data);
+  //! constrói no fim
+  template<typename... Args>
+  void emplace_back(Args&&... args);
+  //! constrói no início
+  template<typename... Args>
+  void emplace_front(Args&&... args);
+  //! constrói na posição
+  template<typename... Args>
+  void emplace(std::size_t index, Args&&... args);
+  //! acessa na posição
+  T& at(std::size_t index);
+  //! acessa na posição
+  const T& at(std::size_t index) const;
+  //! retira da posição
+  T pop(std::size_t index);
+  //! retira do fim
+  T pop_back();
+  //! retira do início
+  T pop_front();
+  //! retira específico
+  void remove(const T& data);
+  //! verifica lista vazia
+  bool empty() const;
+  //! verifica se contém
+  bool contains(const T& data) const;
+  //! posição do data (size() se não encontrar)
+  std::size_t find(const T& data) const;
+  //! tamanho da lista
+  std::size_t size() const;
+  //! quantidade de nós
+  std::size_t nodes() const;
+  //! primeiro elemento
+  Iterator begin();
+  //! depois do último elemento
+  Iterator end();
+  //! primeiro elemento, só leitura
+  ConstIterator begin() const;
+  //! depois do último elemento, só leitura
+  ConstIterator end() const;
+  //! primeiro elemento, só leitura
+  ConstIterator cbegin() const;
+  //! depois do último elemento, só leitura
+  ConstIterator cend() const;
+
+ private:
+  //! nó: count elementos em data
+  struct Node {
+    //! elementos
+    T data[N];
+    //! próximo nó
+    Node* next{nullptr};
+    //! elementos ocupados
+    std::size_t count{0u};
+  };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! reserva e constrói um nó vazio
+  Node* create_node();
+  //! destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! nó da posição index (< size()); index passa a ser a posição no nó
+  Node* locate(std::size_t& index) const;
+  //! insere data na posição offset de node, dividindo-o se estiver cheio
+  void insert_at(Node* node, std::size_t offset, T&& data);
+  //! move a metade final de node para um novo nó seguinte
+  Node* split(Node* node);
+  //! retira a posição offset de node (previous é o nó anterior)
+  T erase(Node* previous, Node* node, std::size_t offset);
+  //! tira node da lista e o devolve
+  void unlink(Node* previous, Node* node);
+  //! posição de data em node (node->count se não encontrar)
+  std::size_t find_in(const Node* node, const T& data) const;
+  //! find_in para T aritmético: kernel vetorizado
+  std::size_t find_in(const Node* node, const T& data, std::true_type) const;
+  //! find_in para os demais T: laço com operator==
+  std::size_t find_in(const Node* node, const T& data, std::false_type) const;
+  //! reserva os nós
+  NodeAllocator allocator_;
+  //! primeiro nó
+  Node* head{nullptr};
+  //! último nó
+  Node* tail{nullptr};
+  //! tamanho da lista
+  std::size_t size_{0u};
+  //! quantidade de nós
+  std::size_t nodes_{0u};
+};
+
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! UnrolledLinkedList com nós em um std::pmr::memory_resource
+template<typename T, std::size_t N = unrolled_capacity(sizeof(T))>
+using UnrolledLinkedList = structures::UnrolledLinkedList<
+    T, N, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, std::size_t N, typename Allocator>
+structures::UnrolledLinkedList<T, N, Allocator>::UnrolledLinkedList() {}
+
+template<typename T, std::size_t N, typename Allocator>
+structures::UnrolledLinkedList<T, N, Allocator>::UnrolledLinkedList(
+    const Allocator& allocator):
+  allocator_{allocator}
+{}
+
+template<typename T, std::size_t N, typename Allocator>
+structures::UnrolledLinkedList<T, N, Allocator>::~UnrolledLinkedList() {
+  clear();
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::clear() {
+  auto current = head;
+  while (current != nullptr) {
+    auto next = current->next;
+    destroy_node(current);
+    current = next;
+  }
+  head = nullptr;
+  tail = nullptr;
+  size_ = 0;
+  nodes_ = 0;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::push_back(
+    const T& data) {
+  emplace_back(data);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::push_front(
+    const T& data) {
+  emplace_front(data);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::insert(
+    const T& data, std::size_t index) {
+  emplace(index, data);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::insert(
+    T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::insert_sorted(
+    const T& data) {
+  insert_sorted(T(data));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::insert_sorted(
+    T&& data) {
+  // maior que o último: direto no fim, sem percorrer
+  if (empty() || data > tail->data[tail->count - 1]) {
+    return push_back(std::move(data));
+  }
+  // pula nós inteiros pelo último elemento; o do fim não é menor que data
+  auto node = head;
+  while (data > node->data[node->count - 1]) {
+    node = node->next;
+  }
+  std::size_t offset = 0;
+  while (data > node->data[offset]) {
+    offset++;
+  }
+  insert_at(node, offset, std::move(data));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+template<typename... Args>
+void structures::UnrolledLinkedList<T, N, Allocator>::emplace_back(
+    Args&&... args) {
+  if (tail == nullptr || tail->count == N) {
+    // nó novo no fim, sem dividir: inserções pelo fim enchem os nós
+    auto node = create_node();
+    if (tail == nullptr) {
+      head = node;
+    } else {
+      tail->next = node;
+    }
+    tail = node;
+  }
+  tail->data[tail->count] = T(std::forward<Args>(args)...);
+  tail->count++;
+  size_++;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+template<typename... Args>
+void structures::UnrolledLinkedList<T, N, Allocator>::emplace_front(
+    Args&&... args) {
+  if (empty()) {
+    return emplace_back(std::forward<Args>(args)...);
+  }
+  insert_at(head, 0, T(std::forward<Args>(args)...));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+template<typename... Args>
+void structures::UnrolledLinkedList<T, N, Allocator>::emplace(
+    std::size_t index, Args&&... args) {
+  if (index > size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  if (index == size()) {
+    return emplace_back(std::forward<Args>(args)...);
+  }
+  // constrói antes de mover elementos: args pode referenciar um deles
+  T data(std::forward<Args>(args)...);
+  auto node = locate(index);
+  insert_at(node, index, std::move(data));
+}
+
+template<typename T, std::size_t N, typename Allocator>
+T& structures::UnrolledLinkedList<T, N, Allocator>::at(std::size_t index) {
+  if (index >= size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  auto node = locate(index);
+  return node->data[index];
+}
+
+template<typename T, std::size_t N, typename Allocator>
+const T& structures::UnrolledLinkedList<T, N, Allocator>::at(
+    std::size_t index) const {
+  if (index >= size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  auto node = locate(index);
+  return node->data[index];
+}
+
+template<typename T, std::size_t N, typename Allocator>
+T structures::UnrolledLinkedList<T, N, Allocator>::pop(std::size_t index) {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  if (index >= size()) {
+    throw std::out_of_range("Índice fora do limite");
+  }
+  Node* previous = nullptr;
+  auto node = head;
+  while (index >= node->count) {
+    index -= node->count;
+    previous = node;
+    node = node->next;
+  }
+  return erase(previous, node, index);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+T structures::UnrolledLinkedList<T, N, Allocator>::pop_back() {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  if (tail->count > 1) {
+    tail->count--;
+    size_--;
+    return std::move(tail->data[tail->count]);
+  }
+  // o último nó vai ficar vazio: precisa do anterior
+  Node* previous = nullptr;
+  if (head != tail) {
+    previous = head;
+    while (previous->next != tail) {
+      previous = previous->next;
+    }
+  }
+  return erase(previous, tail, 0);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+T structures::UnrolledLinkedList<T, N, Allocator>::pop_front() {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  return erase(nullptr, head, 0);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::remove(const T& data) {
+  Node* previous = nullptr;
+  for (auto node = head; node != nullptr; node = node->next) {
+    auto offset = find_in(node, data);
+    if (offset < node->count) {
+      erase(previous, node, offset);
+      return;
+    }
+    previous = node;
+  }
+}
+
+template<typename T, std::size_t N, typename Allocator>
+bool structures::UnrolledLinkedList<T, N, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+bool structures::UnrolledLinkedList<T, N, Allocator>::contains(
+    const T& data) const {
+  return find(data) != size();
+}
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t structures::UnrolledLinkedList<T, N, Allocator>::find(
+    const T& data) const {
+  std::size_t index = 0;
+  for (auto node = head; node != nullptr; node = node->next) {
+    auto offset = find_in(node, data);
+    if (offset < node->count) {
+      return index + offset;
+    }
+    index += node->count;
+  }
+  return size();
+}
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t structures::UnrolledLinkedList<T, N, Allocator>::size() const {
+  return size_;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t structures::UnrolledLinkedList<T, N, Allocator>::nodes() const {
+  return nodes_;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::Iterator
+structures::UnrolledLinkedList<T, N, Allocator>::begin() {
+  return Iterator(head, 0u);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::Iterator
+structures::UnrolledLinkedList<T, N, Allocator>::end() {
+  return Iterator(nullptr, 0u);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::ConstIterator
+structures::UnrolledLinkedList<T, N, Allocator>::begin() const {
+  return ConstIterator(head, 0u);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::ConstIterator
+structures::UnrolledLinkedList<T, N, Allocator>::end() const {
+  return ConstIterator(nullptr, 0u);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::ConstIterator
+structures::UnrolledLinkedList<T, N, Allocator>::cbegin() const {
+  return begin();
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::ConstIterator
+structures::UnrolledLinkedList<T, N, Allocator>::cend() const {
+  return end();
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::Node*
+structures::UnrolledLinkedList<T, N, Allocator>::create_node() {
+  auto node = NodeTraits::allocate(allocator_, 1);
+  try {
+    NodeTraits::construct(allocator_, node);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  nodes_++;
+  return node;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::destroy_node(
+    Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::Node*
+structures::UnrolledLinkedList<T, N, Allocator>::locate(
+    std::size_t& index) const {
+  auto node = head;
+  while (index >= node->count) {
+    index -= node->count;
+    node = node->next;
+  }
+  return node;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::insert_at(
+    Node* node, std::size_t offset, T&& data) {
+  if (node->count == N) {
+    auto next = split(node);
+    if (offset > node->count) {
+      offset -= node->count;
+      node = next;
+    }
+  }
+  std::move_backward(node->data + offset, node->data + node->count,
+                     node->data + node->count + 1);
+  node->data[offset] = std::move(data);
+  node->count++;
+  size_++;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+typename structures::UnrolledLinkedList<T, N, Allocator>::Node*
+structures::UnrolledLinkedList<T, N, Allocator>::split(Node* node) {
+  auto next = create_node();
+  auto keep = node->count - node->count / 2;
+  std::move(node->data + keep, node->data + node->count, next->data);
+  next->count = node->count - keep;
+  node->count = keep;
+  next->next = node->next;
+  node->next = next;
+  if (tail == node) {
+    tail = next;
+  }
+  return next;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+T structures::UnrolledLinkedList<T, N, Allocator>::erase(
+    Node* previous, Node* node, std::size_t offset) {
+  auto data = std::move(node->data[offset]);
+  std::move(node->data + offset + 1, node->data + node->count,
+            node->data + offset);
+  node->count--;
+  size_--;
+  if (node->count == 0) {
+    unlink(previous, node);
+  } else if (node->count < N / 2 && node->next != nullptr &&
+             node->count + node->next->count <= N) {
+    // junta com o seguinte para os nós não ficarem quase vazios
+    auto next = node->next;
+    std::move(next->data, next->data + next->count,
+              node->data + node->count);
+    node->count += next->count;
+    unlink(node, next);
+  }
+  return data;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+void structures::UnrolledLinkedList<T, N, Allocator>::unlink(Node* previous,
+                                                             Node* node) {
+  if (previous == nullptr) {
+    head = node->next;
+  } else {
+    previous->next = node->next;
+  }
+  if (tail == node) {
+    tail = previous;
+  }
+  destroy_node(node);
+  nodes_--;
+}
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t structures::UnrolledLinkedList<T, N, Allocator>::find_in(
+    const Node* node, const T& data) const {
+  return find_in(node, data, simd::has_find<T>());
+}
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t structures::UnrolledLinkedList<T, N, Allocator>::find_in(
+    const Node* node, const T& data, std::true_type) const {
+  return simd::find(node->data, node->count, data);
+}
+
+template<typename T, std::size_t N, typename Allocator>
+std::size_t structures::UnrolledLinkedList<T, N, Allocator>::find_in(
+    const Node* node, const T& data, std::false_type) const {
+  for (auto i = 0u; i < node->count; i++) {
+    if (node->data[i] == data) {
+      return i;
+    }
+  }
+  return node->count;
+}
+
+#endif
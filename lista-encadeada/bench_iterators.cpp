@@ -0,0 +1,51 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de percurso das listas encadeadas: at(i) contra iteradores.
+// Compilar: g++ -O2 -std=c++14 bench_iterators.cpp -o bench_iterators
+#include <chrono>
+#include <cstdio>
+#include "linked_list.h"
+#include "../lista-encadeada-circular/circular_list.h"
+#include "../lista-duplamente-encadeada/doubly_linked_list.h"
+#include "../lista-circular-duplamente-encadeada/doubly_circular_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Soma os elementos por at(i) e por range-for
+template<typename List>
+void run(const char* name, unsigned n) {
+    List list;
+    for (auto i = 0u; i < n; i++) {
+        list.push_back(static_cast<int>(i));
+    }
+    long long by_index = 0, by_iterator = 0;
+    auto at = measure([&] {
+        for (auto i = 0u; i < list.size(); i++) {
+            by_index += list.at(i);
+        }
+    });
+    auto iterator = measure([&] {
+        for (auto data : list) {
+            by_iterator += data;
+        }
+    });
+    std::printf("  %-20s at(i) %10.2f ms  iterador %8.3f ms  (%lld %lld)\n",
+                name, at, iterator, by_index, by_iterator);
+}
+
+int main() {
+    for (auto n : {1000u, 10000u, 30000u}) {
+        std::printf("n=%u\n", n);
+        run<structures::LinkedList<int>>("LinkedList", n);
+        run<structures::CircularList<int>>("CircularList", n);
+        run<structures::DoublyLinkedList<int>>("DoublyLinkedList", n);
+        run<structures::DoublyCircularList<int>>("DoublyCircularList", n);
+    }
+    return 0;
+}
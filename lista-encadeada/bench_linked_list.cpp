@@ -0,0 +1,42 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de construção de listas encadeadas pelo fim.
+// Compilar: g++ -O2 -std=c++14 bench_linked_list.cpp -o bench_linked_list
+#include <chrono>
+#include <cstdio>
+#include "linked_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    for (auto n : {10000u, 100000u, 1000000u}) {
+        structures::LinkedList<int> list;
+        auto push_back = measure([&] {
+            for (auto i = 0u; i < n; i++) {
+                list.push_back(static_cast<int>(i));
+            }
+        });
+        list.clear();
+        auto insert = measure([&] {
+            for (auto i = 0u; i < n; i++) {
+                list.insert(static_cast<int>(i), list.size());
+            }
+        });
+        list.clear();
+        auto insert_sorted = measure([&] {
+            for (auto i = 0u; i < n; i++) {
+                list.insert_sorted(static_cast<int>(i));
+            }
+        });
+        std::printf("n=%-8u push_back %9.2f ms  insert(fim) %9.2f ms  "
+                    "insert_sorted(crescente) %9.2f ms\n", n, push_back,
+                    insert, insert_sorted);
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de alocação de nós: alocador global vs NodePool.
+// Compilar: g++ -O2 -std=c++14 -pthread bench_node_pool.cpp -o bench_node_pool
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include "linked_list.h"
+#include "node_pool.h"
+#include "../fila-encadeada/linked_queue.h"
+#include "../pilha-encadeada/linked_stack.h"
+
+//! Mede o tempo (ms) de fn, melhor de 5 execuções
+template<typename F>
+double measure(F fn) {
+    double best = 1e300;
+    for (auto run = 0; run < 5; run++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        auto elapsed =
+            std::chrono::duration<double, std::milli>(end - start).count();
+        best = elapsed < best ? elapsed : best;
+    }
+    return best;
+}
+
+const unsigned OPERATIONS = 4000000u;
+
+//! dado maior: nó de 56 bytes
+struct Payload {
+    explicit Payload(unsigned data): value{data} {}
+    unsigned value;
+    char padding[44];
+};
+
+//! fila com live elementos: enfileira e desenfileira OPERATIONS vezes
+template<typename T, typename Allocator>
+double queue_churn(const Allocator& allocator, unsigned live) {
+    structures::LinkedQueue<T, Allocator> queue{allocator};
+    for (auto i = 0u; i < live; i++) {
+        queue.enqueue(T(i));
+    }
+    return measure([&] {
+        for (auto i = 0u; i < OPERATIONS; i++) {
+            queue.enqueue(queue.dequeue());
+        }
+    });
+}
+
+//! pilha: rajadas de 1000 empilhamentos seguidas de 1000 desempilhamentos
+template<typename T, typename Allocator>
+double stack_churn(const Allocator& allocator) {
+    structures::LinkedStack<T, Allocator> stack{allocator};
+    return measure([&] {
+        for (auto round = 0u; round < OPERATIONS / 1000u; round++) {
+            for (auto i = 0u; i < 1000u; i++) {
+                stack.push(T(i));
+            }
+            while (!stack.empty()) {
+                stack.pop();
+            }
+        }
+    });
+}
+
+//! lista: constrói pelo fim, retira metade pelo início e percorre
+template<typename T, typename Allocator>
+double list_churn(const Allocator& allocator) {
+    structures::LinkedList<T, Allocator> list{allocator};
+    return measure([&] {
+        for (auto round = 0u; round < 40u; round++) {
+            for (auto i = 0u; i < OPERATIONS / 40u; i++) {
+                list.push_back(T(i));
+                if (i % 2 == 0) {
+                    list.pop_front();
+                }
+            }
+            list.clear();
+        }
+    });
+}
+
+template<typename T>
+void run(const char* name) {
+    structures::NodePool pool;
+    structures::PoolAllocator<T> pooled{pool};
+    structures::SharedPoolAllocator<T> shared;
+    std::allocator<T> global;
+    std::printf("%s\n", name);
+    std::printf("  fila (1000 vivos) global %7.2f ms  pool %7.2f ms  "
+                "compartilhado %7.2f ms\n",
+                queue_churn<T>(global, 1000u), queue_churn<T>(pooled, 1000u),
+                queue_churn<T>(shared, 1000u));
+    std::printf("  pilha (rajadas)   global %7.2f ms  pool %7.2f ms  "
+                "compartilhado %7.2f ms\n", stack_churn<T>(global),
+                stack_churn<T>(pooled), stack_churn<T>(shared));
+    std::printf("  lista             global %7.2f ms  pool %7.2f ms  "
+                "compartilhado %7.2f ms\n", list_churn<T>(global),
+                list_churn<T>(pooled), list_churn<T>(shared));
+}
+
+int main() {
+    std::printf("%u operações por medida\n", OPERATIONS);
+    run<int>("int");
+    run<Payload>("Payload (48 bytes)");
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de ordenação das listas encadeadas: sort() religando os nós
+// contra copiar para um vetor, std::stable_sort e reconstruir a lista.
+// Compilar: g++ -O2 -std=c++14 bench_sort.cpp -o bench_sort
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "linked_list.h"
+#include "../lista-encadeada-circular/circular_list.h"
+#include "../lista-duplamente-encadeada/doubly_linked_list.h"
+#include "../lista-circular-duplamente-encadeada/doubly_circular_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Lista com n valores pseudoaleatórios
+template<typename List>
+void fill(List& list, unsigned n) {
+    std::srand(42);
+    for (auto i = 0u; i < n; i++) {
+        list.push_back(std::rand());
+    }
+}
+
+//! Ordena copiando para um vetor e reconstruindo a lista
+template<typename List>
+void sort_by_copy(List& list) {
+    std::vector<int> values;
+    values.reserve(list.size());
+    while (!list.empty()) {
+        values.push_back(list.pop_front());
+    }
+    std::stable_sort(values.begin(), values.end());
+    for (auto value : values) {
+        list.push_back(value);
+    }
+}
+
+template<typename List>
+void run(const char* name, unsigned n) {
+    List in_place;
+    List copied;
+    fill(in_place, n);
+    fill(copied, n);
+    auto sorted = measure([&] { in_place.sort(); });
+    auto rebuilt = measure([&] { sort_by_copy(copied); });
+    auto same = std::equal(in_place.begin(), in_place.end(), copied.begin());
+    std::printf("%-18s n=%-7u sort %8.2f  cópia+sort %8.2f  %s\n", name, n,
+                sorted, rebuilt, same ? "ok" : "DIFERENTE");
+}
+
+int main() {
+    std::printf("tempos em ms\n");
+    for (auto n : {1000u, 100000u, 1000000u}) {
+        run<structures::LinkedList<int>>("LinkedList", n);
+        run<structures::DoublyLinkedList<int>>("DoublyLinkedList", n);
+        run<structures::DoublyCircularList<int>>("DoublyCircularList", n);
+    }
+    // push_back percorre a lista inteira: tamanhos menores
+    for (auto n : {1000u, 10000u}) {
+        run<structures::CircularList<int>>("CircularList", n);
+    }
+    return 0;
+}
@@ -2,28 +2,124 @@
 #ifndef STRUCTURES_LINKED_LIST_H
 #define STRUCTURES_LINKED_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <type_traits>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
 //! Classe lista encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class LinkedList {
+ private:
+    class Node;
+
  public:
+    //! Iterador para frente; Value é T ou const T
+    template<typename Value>
+    class BasicIterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::remove_const<Value>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        //! Iterador nulo
+        BasicIterator() = default;
+        //! Converte Iterator em ConstIterator
+        template<typename Other, typename = typename std::enable_if<
+            std::is_same<const Other, Value>::value>::type>
+        BasicIterator(const BasicIterator<Other>& other):  // NOLINT
+            node_{other.node_}
+        {}
+        //! Elemento atual
+        reference operator*() const {
+            return node_->data();
+        }
+        //! Elemento atual
+        pointer operator->() const {
+            return &node_->data();
+        }
+        //! Avança para o próximo elemento
+        BasicIterator& operator++() {
+            node_ = node_->next();
+            return *this;
+        }
+        //! Avança para o próximo elemento
+        BasicIterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+        //! Compara posições
+        bool operator==(const BasicIterator& other) const {
+            return node_ == other.node_;
+        }
+        //! Compara posições
+        bool operator!=(const BasicIterator& other) const {
+            return !(*this == other);
+        }
+
+     private:
+        friend class LinkedList;
+        template<typename> friend class BasicIterator;
+        //! Node* ou const Node*
+        using NodePointer = typename std::conditional<
+            std::is_const<Value>::value, const Node*, Node*>::type;
+        //! Iterador no nó node (nullptr: fim)
+        explicit BasicIterator(NodePointer node):
+            node_{node}
+        {}
+        //! Nó atual
+        NodePointer node_{nullptr};
+    };
+    //! Iterador para frente
+    using Iterator = BasicIterator<T>;
+    //! Iterador para frente, só leitura
+    using ConstIterator = BasicIterator<const T>;
+
     //! Construtor
     LinkedList();  // construtor padrão
+    //! Construtor, nós reservados com allocator
+    explicit LinkedList(const Allocator& allocator);
     //! Destrutor
     ~LinkedList();  // destrutor
     //! Limpa a lista
     void clear();  // limpar lista
     //! Insere no fim
     void push_back(const T& data);  // inserir no fim
+    //! Insere no fim, movendo o dado
+    void push_back(T&& data);
     //! Insere no início
     void push_front(const T& data);  // inserir no início
+    //! Insere no início, movendo o dado
+    void push_front(T&& data);
     //! Insere na posição
     void insert(const T& data, std::size_t index);  // inserir na posição
+    //! Insere na posição, movendo o dado
+    void insert(T&& data, std::size_t index);
     //! Insere na ordem
     void insert_sorted(const T& data);  // inserir em ordem
+    //! Insere na ordem, movendo o dado
+    void insert_sorted(T&& data);
+    //! Constrói no fim
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+    //! Constrói no início
+    template<typename... Args>
+    void emplace_front(Args&&... args);
+    //! Constrói na posição
+    template<typename... Args>
+    void emplace(std::size_t index, Args&&... args);
     //! Acessa na posição
     T& at(std::size_t index);  // acessar um elemento na posição index
     //! Retira da posição
@@ -42,19 +138,29 @@ class LinkedList {
     std::size_t find(const T& data) const;  // posição do data
     //! Tamanho da lista
     std::size_t size() const;  // tamanho da lista
+    //! Ordena a lista: merge sort estável que religa os nós, sem alocar
+    void sort();
+    //! Primeiro elemento
+    Iterator begin();
+    //! Depois do último elemento
+    Iterator end();
+    //! Primeiro elemento, só leitura
+    ConstIterator begin() const;
+    //! Depois do último elemento, só leitura
+    ConstIterator end() const;
+    //! Primeiro elemento, só leitura
+    ConstIterator cbegin() const;
+    //! Depois do último elemento, só leitura
+    ConstIterator cend() const;
 
  private:
     //! Elemento
     class Node {  // Elemento
      public:
-        //! Construtor
-        explicit Node(const T& data):
-            data_{data}
-        {}
-        //! Construtor parametrizado
-        Node(const T& data, Node* next):
-            data_{data},
-            next_{next}
+        //! Construtor, dado construído no lugar
+        template<typename... Args>
+        explicit Node(Args&&... args):
+            data_(std::forward<Args>(args)...)
         {}
         //! Acessa data
         T& data() {  // getter: data
@@ -83,80 +189,180 @@ class LinkedList {
         //! Próximo elemento
         Node* next_{nullptr};
     };
-    //! Último elemento da lista
-    Node* end() {  // último nodo da lista
-        auto it = head;
-        for (auto i = 1u; i < size(); ++i) {
-            it = it->next();
-        }
-        return it;
-    }
+    //! Alocador de nós
+    using NodeAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    //! Operações do alocador de nós
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    //! Reserva e constrói um nó
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    //! Destrói e devolve um nó
+    void destroy_node(Node* node);
+    //! Ordena a cadeia chain terminada em nullptr; devolve o primeiro nó
+    static Node* merge_sort(Node* chain);
+    //! Intercala as cadeias ordenadas left e right; iguais de left antes
+    static Node* merge_chains(Node* left, Node* right);
+    //! Reserva os nós
+    NodeAllocator allocator_;
     //! Primeiro elemento da lista
     Node* head{nullptr};
+    //! Último elemento da lista
+    Node* tail{nullptr};
     //! Tamanho da lista
     std::size_t size_{0u};
 };
 
-}  // namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! LinkedList com nós em um std::pmr::memory_resource
 template<typename T>
-structures::LinkedList<T>::LinkedList() {
+using LinkedList =
+    structures::LinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList() {
     size_ = 0;
     head = nullptr;
+    tail = nullptr;
 }
 
-template<typename T>
-structures::LinkedList<T>::~LinkedList() {
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList(const Allocator& allocator):
+    allocator_{allocator}
+{
+    size_ = 0;
+    head = nullptr;
+    tail = nullptr;
+}
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::~LinkedList() {
     clear();
 }
 
-template<typename T>
-void structures::LinkedList<T>::clear() {
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::clear() {
     Node* current = head;
     while (current != nullptr) {
         auto next = current->next();
-        delete current;
+        destroy_node(current);
         current = next;
     }
     head = nullptr;
+    tail = nullptr;
     size_ = 0;
 }
 
-template<typename T>
-void structures::LinkedList<T>::push_back(const T& data) {
-    Node* element = new Node(data);
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert(
+    const T& data, std::size_t index) {
+    emplace(index, data);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert(T&& data, std::size_t index) {
+    emplace(index, std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert_sorted(const T& data) {
+    insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert_sorted(T&& data) {
+    if (size() == 0) {
+        return push_front(std::move(data));
+    }
+    // maior que o último: direto no fim, sem percorrer
+    if (data > tail->data()) {
+        return push_back(std::move(data));
+    }
+    auto current = head;
+    auto pos = 0u;
+    while (current->next() != nullptr && data > current->data()) {
+        current = current->next();
+        pos++;
+    }
+    if (data > current->data()) {
+        return insert(std::move(data), pos + 1);
+    } else {
+        return insert(std::move(data), pos);
+    }
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::LinkedList<T, Allocator>::emplace_back(Args&&... args) {
+    Node* element = create_node(std::forward<Args>(args)...);
     if (element == nullptr) {
         throw std::out_of_range("Lista cheia");
     }
     if (size() == 0) {
         head = element;
-        size_++;
     } else {
-        auto last = end();
-        last->next(element);
-        size_ += 1;
+        tail->next(element);
     }
+    tail = element;
+    size_ += 1;
 }
 
-template<typename T>
-void structures::LinkedList<T>::push_front(const T& data) {
-    Node* element = new Node(data, head);
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::LinkedList<T, Allocator>::emplace_front(Args&&... args) {
+    Node* element = create_node(std::forward<Args>(args)...);
     if (element == nullptr) {
         throw std::out_of_range("Lista cheia");
     }
+    element->next(head);
     head = element;
+    if (tail == nullptr) {
+        tail = element;
+    }
     size_ += 1;
 }
 
-template<typename T>
-void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::LinkedList<T, Allocator>::emplace(
+    std::size_t index, Args&&... args) {
     if (index > size()) {
         throw std::out_of_range("Índice fora do limite");
     }
     if (index == 0) {
-        return push_front(data);
+        return emplace_front(std::forward<Args>(args)...);
+    }
+    if (index == size()) {
+        return emplace_back(std::forward<Args>(args)...);
     }
-    Node* element = new Node(data);
+    Node* element = create_node(std::forward<Args>(args)...);
     if (element == nullptr) {
         throw std::out_of_range("Lista cheia");
     }
@@ -171,30 +377,8 @@ void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
     size_++;
 }
 
-template<typename T>
-void structures::LinkedList<T>::insert_sorted(const T& data) {
-    Node* element = new Node(data);
-    if (element == nullptr) {
-        throw std::out_of_range("Lista cheia");
-    }
-    if (size() == 0) {
-        return push_front(data);
-    }
-    auto current = head;
-    auto pos = 0u;
-    while (current->next() != nullptr && data > current->data()) {
-        current = current->next();
-        pos++;
-    }
-    if (data > current->data()) {
-        return insert(data, pos + 1);
-    } else {
-        return insert(data, pos);
-    }
-}
-
-template<typename T>
-T& structures::LinkedList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::LinkedList<T, Allocator>::at(std::size_t index) {
     if (index > size() - 1) {
         throw std::out_of_range("Índice fora do limite");
     }
@@ -205,8 +389,8 @@ T& structures::LinkedList<T>::at(std::size_t index) {
     return current->data();
 }
 
-template<typename T>
-T structures::LinkedList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("Lista vazia");
     }
@@ -216,28 +400,32 @@ T structures::LinkedList<T>::pop(std::size_t index) {
     if (index == 0) {
         return pop_front();
     }
+    if (index == size() - 1) {
+        return pop_back();
+    }
     auto previous = head;
     for (auto i = 1u; i < index; i++) {
         previous = previous->next();
     }
     auto exclude = previous->next();
-    auto data = exclude->data();
+    auto data = std::move(exclude->data());
     previous->next(exclude->next());
     size_--;
-    delete exclude;
+    destroy_node(exclude);
     return data;
 }
 
-template<typename T>
-T structures::LinkedList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop_back() {
     if (empty()) {
         throw std::out_of_range("Lista vazia");
     }
     if (size() == 1) {
         auto aux = head;
-        auto data = aux->data();
-        delete aux;
+        auto data = std::move(aux->data());
+        destroy_node(aux);
         head = nullptr;
+        tail = nullptr;
         size_--;
         return data;
     }
@@ -246,28 +434,32 @@ T structures::LinkedList<T>::pop_back() {
         previous = previous->next();
     }
     auto exclude = previous->next();
-    auto data = exclude->data();
+    auto data = std::move(exclude->data());
     previous->next(nullptr);
+    tail = previous;
     size_--;
-    delete exclude;
+    destroy_node(exclude);
     return data;
 }
 
-template<typename T>
-T structures::LinkedList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("Lista vazia");
     }
     auto previous_head = head;
-    auto data = previous_head->data();
+    auto data = std::move(previous_head->data());
     head = previous_head->next();
+    if (head == nullptr) {
+        tail = nullptr;
+    }
     size_--;
-    delete previous_head;
+    destroy_node(previous_head);
     return data;
 }
 
-template<typename T>
-void structures::LinkedList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::remove(const T& data) {
     auto current = head;
     for (auto i = 0u; i < size(); i++) {
         if (data == current->data()) {
@@ -278,13 +470,13 @@ void structures::LinkedList<T>::remove(const T& data) {
     }
 }
 
-template<typename T>
-bool structures::LinkedList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::LinkedList<T, Allocator>::empty() const {
     return size_ == 0;
 }
 
-template<typename T>
-bool structures::LinkedList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::LinkedList<T, Allocator>::contains(const T& data) const {
     auto current = head;
     for (auto i = 0u; i < size(); i++) {
         if (data == current->data()) {
@@ -295,8 +487,8 @@ bool structures::LinkedList<T>::contains(const T& data) const {
     return false;
 }
 
-template<typename T>
-std::size_t structures::LinkedList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedList<T, Allocator>::find(const T& data) const {
     auto current = head;
     for (auto i = 0u; i < size(); i++) {
         if (data == current->data()) {
@@ -307,9 +499,139 @@ std::size_t structures::LinkedList<T>::find(const T& data) const {
     return size();
 }
 
-template<typename T>
-std::size_t structures::LinkedList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedList<T, Allocator>::size() const {
     return size_;
 }
 
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::sort() {
+    if (size() < 2u) {
+        return;
+    }
+    head = merge_sort(head);
+    tail = head;
+    while (tail->next() != nullptr) {
+        tail = tail->next();
+    }
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::Node*
+structures::LinkedList<T, Allocator>::merge_sort(Node* chain) {
+    // de baixo para cima: bins[k] guarda uma sequência ordenada de 2^k nós
+    // (ou nenhuma); cada nó entra como sequência de um e sobe intercalando,
+    // enquanto as sequências curtas ainda estão em cache
+    Node* bins[std::numeric_limits<std::size_t>::digits] = {};
+    auto used = 0u;
+    while (chain != nullptr) {
+        auto carry = chain;
+        chain = chain->next();
+        carry->next(nullptr);
+        auto k = 0u;
+        for (; k < used && bins[k] != nullptr; k++) {
+            // bins[k] veio antes na lista: fica à esquerda
+            carry = merge_chains(bins[k], carry);
+            bins[k] = nullptr;
+        }
+        if (k == used) {
+            used++;
+        }
+        bins[k] = carry;
+    }
+    Node* sorted = nullptr;
+    for (auto k = 0u; k < used; k++) {
+        sorted = merge_chains(bins[k], sorted);
+    }
+    return sorted;
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::Node*
+structures::LinkedList<T, Allocator>::merge_chains(
+    Node* left, Node* right) {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    Node* first = nullptr;
+    Node* last = nullptr;
+    while (left != nullptr && right != nullptr) {
+        Node* next;
+        if (left->data() > right->data()) {
+            next = right;
+            right = right->next();
+        } else {
+            next = left;
+            left = left->next();
+        }
+        if (last == nullptr) {
+            first = next;
+        } else {
+            last->next(next);
+        }
+        last = next;
+    }
+    last->next(left != nullptr ? left : right);
+    return first;
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::Iterator
+structures::LinkedList<T, Allocator>::begin() {
+    return Iterator(head);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::Iterator
+structures::LinkedList<T, Allocator>::end() {
+    return Iterator(nullptr);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::ConstIterator
+structures::LinkedList<T, Allocator>::begin() const {
+    return ConstIterator(head);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::ConstIterator
+structures::LinkedList<T, Allocator>::end() const {
+    return ConstIterator(nullptr);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::ConstIterator
+structures::LinkedList<T, Allocator>::cbegin() const {
+    return begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::ConstIterator
+structures::LinkedList<T, Allocator>::cend() const {
+    return end();
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::LinkedList<T, Allocator>::Node*
+structures::LinkedList<T, Allocator>::create_node(Args&&... args) {
+    auto node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
 #endif
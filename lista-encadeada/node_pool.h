@@ -0,0 +1,396 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_NODE_POOL_H
+#define STRUCTURES_NODE_POOL_H
+
+#include <cstddef>  // std::max_align_t
+#include <mutex>  // std::mutex, std::lock_guard
+#include <new>  // ::operator new, std::bad_alloc
+#include <type_traits>  // std::true_type
+
+namespace structures {
+
+//! Pool de blocos de tamanho fixo para os nós das estruturas encadeadas
+/*!
+  Os blocos são cortados de lajes (slabs) que dobram de tamanho até
+  MAX_SLAB blocos; os blocos devolvidos formam uma lista livre intrusiva,
+  guardada nos próprios blocos. allocate e deallocate são O(1) e a
+  memória só volta ao sistema no destrutor, que deve rodar depois de
+  todos os nós serem devolvidos. Sem block_size, o tamanho é fixado pelo
+  primeiro accepts(). Não é thread-safe (ver SharedPoolAllocator).
+*/
+class NodePool {
+ public:
+  //! construtor: blocos de block_size bytes (0: fixado depois)
+  explicit NodePool(std::size_t block_size = 0u);
+  //! não copiável: os nós apontam para as lajes
+  NodePool(const NodePool&) = delete;
+  //! não copiável
+  NodePool& operator=(const NodePool&) = delete;
+  //! destrutor
+  ~NodePool();
+  //! verifica se serve blocos de size bytes (fixa o tamanho se não houver)
+  bool accepts(std::size_t size);
+  //! reserva um bloco
+  void* allocate();
+  //! devolve um bloco
+  void deallocate(void* block);
+  //! tamanho dos blocos (0 se ainda não fixado)
+  std::size_t block_size() const;
+  //! quantidade de lajes alocadas
+  std::size_t slabs() const;
+  //! blocos reservados e ainda não devolvidos
+  std::size_t used() const;
+
+ private:
+  //! cabeçalho de uma laje; os blocos vêm depois de HEADER bytes
+  struct Slab {
+    //! laje anterior
+    Slab* next;
+  };
+  //! bloco livre: o início do bloco guarda o próximo livre
+  struct Free {
+    //! próximo bloco livre
+    Free* next;
+  };
+  //! tamanho do bloco para size bytes: cabe um ponteiro, mantém alinhamento
+  static std::size_t round(std::size_t size);
+  //! aloca uma nova laje e passa a cortar blocos dela
+  void grow();
+  //! lista livre
+  Free* free_{nullptr};
+  //! próximo bloco nunca usado da laje atual
+  char* next_{nullptr};
+  //! fim da laje atual
+  char* end_{nullptr};
+  //! laje atual (início da lista de lajes)
+  Slab* slabs_{nullptr};
+  //! tamanho dos blocos
+  std::size_t block_size_;
+  //! blocos da próxima laje
+  std::size_t slab_blocks_{MIN_SLAB};
+  //! quantidade de lajes
+  std::size_t slab_count_{0u};
+  //! blocos em uso
+  std::size_t used_{0u};
+  //! bytes do cabeçalho da laje, preservando o alinhamento máximo
+  static const std::size_t HEADER = alignof(std::max_align_t);
+  //! blocos da primeira laje
+  static const std::size_t MIN_SLAB = 64u;
+  //! blocos máximos por laje
+  static const std::size_t MAX_SLAB = 4096u;
+};
+
+//! Alocador compatível com std que tira blocos de um NodePool
+/*!
+  Pedidos de um único T do tamanho dos blocos vão para o pool; os demais
+  (vetores, outro tamanho após rebind) vão para ::operator new. As cópias
+  e os rebinds compartilham o pool, que deve viver mais que o container.
+*/
+template<typename T>
+class PoolAllocator {
+ public:
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "PoolAllocator não suporta tipos superalinhados");
+  using value_type = T;
+
+  //! construtor: usa pool
+  explicit PoolAllocator(NodePool& pool) noexcept;
+  //! rebind: mesmo pool
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U>& other) noexcept;  // NOLINT
+  //! reserva n objetos
+  T* allocate(std::size_t n);
+  //! devolve n objetos
+  void deallocate(T* data, std::size_t n) noexcept;
+  //! pool usado
+  NodePool* pool() const noexcept;
+
+ private:
+  //! pool
+  NodePool* pool_;
+};
+
+//! Pool global por tamanho de bloco, com cache de blocos por thread
+/*!
+  Cada thread reserva e devolve blocos a uma lista livre própria, sem
+  travas; só quando ela esvazia ou passa de 2 * BATCH blocos um lote de
+  BATCH é trocado com o NodePool central, protegido por mutex. O pool
+  central nunca é destruído, para que nós devolvidos por outras threads
+  (ou depois do fim de uma thread) continuem válidos.
+*/
+template<std::size_t Size>
+class SharedNodePool {
+ public:
+  //! reserva um bloco de Size bytes
+  static void* allocate();
+  //! devolve um bloco reservado por allocate, de qualquer thread
+  static void deallocate(void* block);
+
+ private:
+  //! pool central
+  struct Central {
+    //! protege pool
+    std::mutex mutex;
+    //! blocos
+    NodePool pool{Size};
+  };
+  //! blocos livres da thread
+  struct Cache {
+    //! devolve os blocos ao pool central quando a thread termina
+    ~Cache();
+    //! lista livre (o início do bloco guarda o próximo)
+    void* free{nullptr};
+    //! tamanho da lista livre
+    std::size_t count{0u};
+  };
+  //! pool central, criado no primeiro uso
+  static Central& central();
+  //! cache da thread atual
+  static Cache& cache();
+  //! move até count blocos do cache para o pool central
+  static void flush(Cache& cache, std::size_t count);
+  //! blocos trocados com o pool central de cada vez
+  static const std::size_t BATCH = 64u;
+};
+
+//! Alocador compatível com std sobre SharedNodePool, sem estado
+template<typename T>
+class SharedPoolAllocator {
+ public:
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "SharedPoolAllocator não suporta tipos superalinhados");
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  //! construtor
+  SharedPoolAllocator() noexcept = default;
+  //! rebind
+  template<typename U>
+  SharedPoolAllocator(const SharedPoolAllocator<U>&) noexcept {}  // NOLINT
+  //! reserva n objetos
+  T* allocate(std::size_t n);
+  //! devolve n objetos
+  void deallocate(T* data, std::size_t n) noexcept;
+};
+
+//! alocadores que usam o mesmo pool são iguais
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b) {
+  return a.pool() == b.pool();
+}
+
+//! alocadores que usam pools diferentes são diferentes
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b) {
+  return !(a == b);
+}
+
+//! alocadores sem estado são sempre iguais
+template<typename T, typename U>
+bool operator==(const SharedPoolAllocator<T>&,
+                const SharedPoolAllocator<U>&) {
+  return true;
+}
+
+//! alocadores sem estado são sempre iguais
+template<typename T, typename U>
+bool operator!=(const SharedPoolAllocator<T>&,
+                const SharedPoolAllocator<U>&) {
+  return false;
+}
+
+}  // namespace structures
+
+inline structures::NodePool::NodePool(std::size_t block_size):
+  block_size_{block_size == 0u ? 0u : round(block_size)}
+{}
+
+inline structures::NodePool::~NodePool() {
+  while (slabs_ != nullptr) {
+    auto next = slabs_->next;
+    ::operator delete(slabs_);
+    slabs_ = next;
+  }
+}
+
+inline bool structures::NodePool::accepts(std::size_t size) {
+  if (block_size_ == 0u) {
+    block_size_ = round(size);
+  }
+  return block_size_ == round(size);
+}
+
+inline void* structures::NodePool::allocate() {
+  used_++;
+  if (free_ != nullptr) {
+    auto block = free_;
+    free_ = block->next;
+    return block;
+  }
+  if (next_ == end_) {
+    grow();
+  }
+  auto block = next_;
+  next_ += block_size_;
+  return block;
+}
+
+inline void structures::NodePool::deallocate(void* block) {
+  auto free = static_cast<Free*>(block);
+  free->next = free_;
+  free_ = free;
+  used_--;
+}
+
+inline std::size_t structures::NodePool::block_size() const {
+  return block_size_;
+}
+
+inline std::size_t structures::NodePool::slabs() const {
+  return slab_count_;
+}
+
+inline std::size_t structures::NodePool::used() const {
+  return used_;
+}
+
+inline std::size_t structures::NodePool::round(std::size_t size) {
+  // múltiplo de sizeof(Free): como sizeof(T) é múltiplo de alignof(T),
+  // blocos consecutivos continuam alinhados para T
+  auto unit = sizeof(Free);
+  return size < unit ? unit : (size + unit - 1) / unit * unit;
+}
+
+inline void structures::NodePool::grow() {
+  if (block_size_ == 0u) {
+    block_size_ = round(1u);
+  }
+  auto bytes = HEADER + slab_blocks_ * block_size_;
+  auto slab = static_cast<Slab*>(::operator new(bytes));
+  slab->next = slabs_;
+  slabs_ = slab;
+  next_ = reinterpret_cast<char*>(slab) + HEADER;
+  end_ = next_ + slab_blocks_ * block_size_;
+  slab_count_++;
+  if (slab_blocks_ < MAX_SLAB) {
+    slab_blocks_ *= 2;
+  }
+}
+
+template<typename T>
+structures::PoolAllocator<T>::PoolAllocator(NodePool& pool) noexcept:
+  pool_{&pool}
+{}
+
+template<typename T>
+template<typename U>
+structures::PoolAllocator<T>::PoolAllocator(
+    const PoolAllocator<U>& other) noexcept:
+  pool_{other.pool()}
+{}
+
+template<typename T>
+T* structures::PoolAllocator<T>::allocate(std::size_t n) {
+  if (n == 1u && pool_->accepts(sizeof(T))) {
+    return static_cast<T*>(pool_->allocate());
+  }
+  return static_cast<T*>(::operator new(n * sizeof(T)));
+}
+
+template<typename T>
+void structures::PoolAllocator<T>::deallocate(T* data,
+                                              std::size_t n) noexcept {
+  if (n == 1u && pool_->accepts(sizeof(T))) {
+    pool_->deallocate(data);
+  } else {
+    ::operator delete(data);
+  }
+}
+
+template<typename T>
+structures::NodePool* structures::PoolAllocator<T>::pool() const noexcept {
+  return pool_;
+}
+
+template<std::size_t Size>
+void* structures::SharedNodePool<Size>::allocate() {
+  auto& local = cache();
+  if (local.free == nullptr) {
+    auto& shared = central();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (auto i = 0u; i < BATCH; i++) {
+      auto block = shared.pool.allocate();
+      *static_cast<void**>(block) = local.free;
+      local.free = block;
+    }
+    local.count += BATCH;
+  }
+  auto block = local.free;
+  local.free = *static_cast<void**>(block);
+  local.count--;
+  return block;
+}
+
+template<std::size_t Size>
+void structures::SharedNodePool<Size>::deallocate(void* block) {
+  auto& local = cache();
+  *static_cast<void**>(block) = local.free;
+  local.free = block;
+  local.count++;
+  if (local.count > 2 * BATCH) {
+    flush(local, BATCH);
+  }
+}
+
+template<std::size_t Size>
+typename structures::SharedNodePool<Size>::Central&
+structures::SharedNodePool<Size>::central() {
+  // nunca destruído: blocos podem ser devolvidos até o fim do programa
+  static auto shared = new Central();
+  return *shared;
+}
+
+template<std::size_t Size>
+typename structures::SharedNodePool<Size>::Cache&
+structures::SharedNodePool<Size>::cache() {
+  thread_local Cache local;
+  return local;
+}
+
+template<std::size_t Size>
+void structures::SharedNodePool<Size>::flush(Cache& cache,
+                                             std::size_t count) {
+  auto& shared = central();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  for (; count > 0 && cache.free != nullptr; count--) {
+    auto block = cache.free;
+    cache.free = *static_cast<void**>(block);
+    cache.count--;
+    shared.pool.deallocate(block);
+  }
+}
+
+template<std::size_t Size>
+structures::SharedNodePool<Size>::Cache::~Cache() {
+  flush(*this, count);
+}
+
+template<typename T>
+T* structures::SharedPoolAllocator<T>::allocate(std::size_t n) {
+  if (n == 1u) {
+    return static_cast<T*>(SharedNodePool<sizeof(T)>::allocate());
+  }
+  return static_cast<T*>(::operator new(n * sizeof(T)));
+}
+
+template<typename T>
+void structures::SharedPoolAllocator<T>::deallocate(T* data,
+                                                    std::size_t n) noexcept {
+  if (n == 1u) {
+    SharedNodePool<sizeof(T)>::deallocate(data);
+  } else {
+    ::operator delete(data);
+  }
+}
+
+#endif
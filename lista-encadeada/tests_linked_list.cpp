@@ -1,6 +1,16 @@
 #include "gtest/gtest.h"
 #include "linked_list.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
 int main(int argc, char* argv[]) {
     std::srand(std::time(NULL));
     ::testing::InitGoogleTest(&argc, argv);
@@ -207,4 +217,161 @@ TEST_F(LinkedListTest, RemoveElement) {
     list.remove(4);
     ASSERT_EQ(9u, list.size());
     ASSERT_FALSE(list.contains(4));
-}
\ No newline at end of file
+}
+
+TEST(LinkedListMoveTest, SortRelinksNodes) {
+    // sort só religa os nós: cada string fica no nó em que foi construída
+    structures::LinkedList<std::string> list{};
+    const std::string* address[6];
+    for (auto c : {'d', 'a', 'f', 'c', 'b'}) {
+        list.emplace_back(1u, c);
+        address[c - 'a'] = &list.at(list.size() - 1);
+    }
+    list.sort();
+    list.emplace(4u, 1u, 'e');
+    address[4] = &list.at(4);
+    for (auto i = 0u; i < 6u; ++i) {
+        ASSERT_EQ(std::string(1u, static_cast<char>('a' + i)), list.at(i));
+        ASSERT_EQ(address[i], &list.at(i));
+    }
+}
+
+TEST_F(LinkedListTest, PushBackAfterRemovals) {
+    // o fim da lista deve acompanhar todas as retiradas
+    list.push_back(0);
+    list.pop_back();
+    list.push_back(1);
+    list.push_back(2);
+    list.pop_front();
+    list.pop_front();
+    list.push_back(3);
+    list.push_back(4);
+    list.push_back(5);
+    ASSERT_EQ(5, list.pop(2u));
+    list.push_back(6);
+    list.remove(6);
+    list.insert(7, 2u);
+    list.insert_sorted(8);
+    list.insert_sorted(0);
+    list.push_back(9);
+    ASSERT_EQ(6u, list.size());
+    for (auto expected : {0, 3, 4, 7, 8, 9}) {
+        ASSERT_EQ(expected, list.pop_front());
+    }
+    list.push_back(10);
+    list.clear();
+    list.push_back(11);
+    ASSERT_EQ(1u, list.size());
+    ASSERT_EQ(11, list.at(0));
+}
+
+#if __cplusplus >= 201703L
+TEST(LinkedListPmrTest, FailedPushBackKeepsTail) {
+    // insert_sorted de um maior que todos vai direto para tail; um
+    // push_back que falhou não pode ter deixado tail fora do último nó
+    alignas(std::max_align_t) char buffer[1 << 13];
+    std::pmr::monotonic_buffer_resource upstream{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    std::pmr::unsynchronized_pool_resource resource{&upstream};
+    structures::pmr::LinkedList<int> container{&resource};
+    auto pushed = 0;
+    try {
+        for (; pushed < 10000; pushed++) {
+            container.insert_sorted(pushed);
+        }
+    } catch (const std::bad_alloc&) {
+    }
+    ASSERT_GT(pushed, 1);
+    ASSERT_LT(pushed, 10000);
+    ASSERT_THROW(container.push_back(pushed), std::bad_alloc);
+    // o nó de pop_front volta ao pool e serve o próximo
+    ASSERT_EQ(0, container.pop_front());
+    container.insert_sorted(pushed);
+    ASSERT_EQ(static_cast<std::size_t>(pushed), container.size());
+    ASSERT_EQ(pushed, container.at(container.size() - 1));
+    ASSERT_EQ(pushed, container.pop_back());
+    ASSERT_EQ(pushed - 1, container.pop_back());
+}
+
+#endif
+
+TEST_F(LinkedListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto& data : list) {
+        ASSERT_EQ(expected++, data);
+        data *= 2;
+    }
+    ASSERT_EQ(10, expected);
+    const auto& const_list = list;
+    auto sum = 0;
+    for (auto data : const_list) {
+        sum += data;
+    }
+    ASSERT_EQ(90, sum);
+    ASSERT_EQ(10, std::distance(list.begin(), list.end()));
+    auto it = std::find(list.begin(), list.end(), 8);
+    ASSERT_EQ(8, *it);
+    structures::LinkedList<int>::ConstIterator converted = it;
+    ASSERT_EQ(10, *++converted);
+    ASSERT_TRUE(std::find(list.begin(), list.end(), 7) == list.end());
+}
+
+namespace {
+// chave comparada pela ordenação; tag só distingue iguais
+struct Keyed {
+    int key;
+    int tag;
+    bool operator>(const Keyed& other) const { return key > other.key; }
+};
+}  // namespace
+
+TEST_F(LinkedListTest, SortMatchesReference) {
+    list.sort();
+    ASSERT_TRUE(list.empty());
+    list.push_back(1);
+    list.sort();
+    ASSERT_EQ(1, list.at(0));
+    list.clear();
+    std::srand(11);
+    for (auto n : {2, 3, 7, 64, 100, 1000}) {
+        std::vector<int> reference;
+        for (auto i = 0; i < n; ++i) {
+            reference.push_back(std::rand() % 50);
+            list.push_back(reference.back());
+        }
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        ASSERT_EQ(reference.size(), list.size());
+        ASSERT_TRUE(std::equal(reference.begin(), reference.end(),
+                               list.begin()));
+        // extremos e ligações continuam válidos depois de religar os nós
+        list.push_back(100);
+        list.push_front(-1);
+        ASSERT_EQ(100, list.pop_back());
+        ASSERT_EQ(-1, list.pop_front());
+        ASSERT_EQ(reference.back(), list.pop_back());
+        ASSERT_EQ(reference.front(), list.at(0));
+        list.clear();
+    }
+}
+
+TEST_F(LinkedListTest, SortIsStable) {
+    structures::LinkedList<Keyed> keyed;
+    for (auto i = 0; i < 200; ++i) {
+        keyed.push_back(Keyed{(i * 7) % 5, i});
+    }
+    keyed.sort();
+    auto previous = Keyed{-1, -1};
+    for (const auto& data : keyed) {
+        ASSERT_FALSE(previous > data);
+        if (previous.key == data.key) {
+            ASSERT_GT(data.tag, previous.tag);
+        }
+        previous = data;
+    }
+    ASSERT_EQ(200u, keyed.size());
+}
@@ -0,0 +1,120 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#include "gtest/gtest.h"
+#include "node_pool.h"
+#include "linked_list.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(NodePoolTest, ReusesFreedBlocks) {
+    structures::NodePool pool{24u};
+    auto first = pool.allocate();
+    auto second = pool.allocate();
+    ASSERT_NE(first, second);
+    ASSERT_EQ(2u, pool.used());
+    pool.deallocate(first);
+    ASSERT_EQ(first, pool.allocate());
+    pool.deallocate(first);
+    pool.deallocate(second);
+    ASSERT_EQ(0u, pool.used());
+    ASSERT_EQ(1u, pool.slabs());
+}
+
+TEST(NodePoolTest, SlabsGrow) {
+    structures::NodePool pool{16u};
+    std::vector<void*> blocks;
+    for (auto i = 0u; i < 10000u; i++) {
+        blocks.push_back(pool.allocate());
+    }
+    // lajes dobram de tamanho: poucas para muitos blocos
+    ASSERT_LT(pool.slabs(), 10u);
+    for (auto block : blocks) {
+        pool.deallocate(block);
+    }
+    auto slabs = pool.slabs();
+    for (auto i = 0u; i < 10000u; i++) {
+        blocks[i] = pool.allocate();
+    }
+    ASSERT_EQ(slabs, pool.slabs());
+    for (auto block : blocks) {
+        pool.deallocate(block);
+    }
+}
+
+TEST(NodePoolTest, BlockSizeFixedOnFirstUse) {
+    structures::NodePool pool;
+    ASSERT_EQ(0u, pool.block_size());
+    ASSERT_TRUE(pool.accepts(20u));
+    ASSERT_EQ(24u, pool.block_size());
+    ASSERT_TRUE(pool.accepts(24u));
+    ASSERT_FALSE(pool.accepts(40u));
+}
+
+TEST(NodePoolTest, PoolAllocatorFallsBack) {
+    structures::NodePool pool;
+    structures::PoolAllocator<long> allocator{pool};
+    auto single = allocator.allocate(1u);
+    auto array = allocator.allocate(8u);
+    ASSERT_EQ(1u, pool.used());
+    for (auto i = 0; i < 8; i++) {
+        array[i] = i;
+    }
+    allocator.deallocate(array, 8u);
+    allocator.deallocate(single, 1u);
+    ASSERT_EQ(0u, pool.used());
+
+    structures::PoolAllocator<char> rebound{allocator};
+    ASSERT_TRUE(rebound == allocator);
+    structures::NodePool other;
+    ASSERT_TRUE(rebound != structures::PoolAllocator<char>{other});
+}
+
+TEST(NodePoolTest, LinkedListWithPool) {
+    structures::NodePool pool;
+    {
+        structures::PoolAllocator<std::string> allocator{pool};
+        structures::LinkedList<std::string,
+            structures::PoolAllocator<std::string>> list{allocator};
+        for (auto i = 0; i < 1000; i++) {
+            list.push_back(std::to_string(i));
+        }
+        ASSERT_EQ(1000u, pool.used());
+        for (auto i = 0; i < 500; i++) {
+            ASSERT_EQ(std::to_string(i), list.pop_front());
+        }
+        ASSERT_EQ(500u, pool.used());
+        list.insert_sorted("0");
+        ASSERT_EQ("0", list.at(0));
+    }
+    ASSERT_EQ(0u, pool.used());
+}
+
+TEST(NodePoolTest, SharedPoolAcrossThreads) {
+    using Allocator = structures::SharedPoolAllocator<int>;
+    std::vector<structures::LinkedList<int, Allocator>> lists(4);
+    std::vector<std::thread> threads;
+    for (auto t = 0u; t < lists.size(); t++) {
+        threads.emplace_back([&lists, t] {
+            for (auto i = 0; i < 20000; i++) {
+                lists[t].push_back(i);
+                if (i % 3 == 0) {
+                    lists[t].pop_front();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // nós criados em outras threads são devolvidos nesta
+    for (auto& list : lists) {
+        ASSERT_EQ(13333u, list.size());
+        list.clear();
+    }
+}
@@ -0,0 +1,88 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de memória e busca: ArrayListString x FrontCodedList.
+// Compilar: g++ -O2 -std=c++14 bench_front_coded_list.cpp -o bench_front
+// Uso: ./bench_front [arquivo com uma chave por linha]
+//      (ex.: find /usr > caminhos.txt); sem arquivo, gera 1M URLs.
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "front_coded_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Chaves lidas de path, ou URLs geradas se path for nulo
+std::vector<std::string> keys(const char* path) {
+  std::vector<std::string> keys;
+  if (path != nullptr) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+      keys.push_back(line);
+    }
+    return keys;
+  }
+  std::mt19937 random(42);
+  const char* sections[] = {"produtos", "categorias", "usuarios", "busca"};
+  for (auto i = 0u; i < 1000000u; i++) {
+    keys.push_back("https://www.example.com.br/" +
+                   std::string(sections[random() % 4]) + "/" +
+                   std::to_string(random() % 100000) + "/item-" +
+                   std::to_string(i));
+  }
+  return keys;
+}
+
+int main(int argc, char* argv[]) {
+  auto input = keys(argc > 1 ? argv[1] : nullptr);
+  structures::ArrayListString list(input.size(), false);
+  std::size_t bytes = 0;
+  for (auto& key : input) {
+    list.push_back(key.c_str());
+    bytes += key.size() + 1;
+  }
+  list.sort();
+  // strings na arena + ponteiro e chave por entrada (sem o índice hash)
+  auto list_memory = bytes + list.size() * (sizeof(char*) + 8u);
+  std::printf("%zu chaves, %.1f bytes em média\n", list.size(),
+              static_cast<double>(bytes) / list.size() - 1);
+  std::printf("ArrayListString  %10zu bytes\n", list_memory);
+  std::mt19937 random(7);
+  const auto queries = 200000u;
+  std::size_t found = 0;
+  auto binary = measure([&] {
+    for (auto q = 0u; q < queries; q++) {
+      found += list.find(input[random() % input.size()].c_str());
+    }
+  }) * 1e6 / queries;
+  std::printf("ArrayListString  find %7.1f ns\n", binary);
+  for (auto bucket : {4u, 16u, 64u}) {
+    structures::FrontCodedList frozen(list, bucket);
+    std::size_t length = 0;
+    auto iteration = measure([&] {
+      for (auto& key : frozen) {
+        length += key.size();
+      }
+    });
+    auto front = measure([&] {
+      for (auto q = 0u; q < queries; q++) {
+        found += frozen.find(input[random() % input.size()].c_str());
+      }
+    }) * 1e6 / queries;
+    std::printf("balde %-3u        %10zu bytes (%5.1f%%)  find %7.1f ns  "
+                "iteração %7.2f ms  (%zu)\n", bucket, frozen.memory(),
+                100.0 * frozen.memory() / list_memory, front, iteration,
+                length);
+  }
+  std::printf("(%zu)\n", found);
+  return 0;
+}
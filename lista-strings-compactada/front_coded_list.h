@@ -0,0 +1,286 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_FRONT_CODED_LIST_H
+#define STRUCTURES_FRONT_CODED_LIST_H
+
+#include <algorithm>  // std::min
+#include <cstddef>  // std::ptrdiff_t
+#include <cstdint>
+#include <cstring>  // std::strlen
+#include <iterator>
+#include <stdexcept>  // C++ exceptions
+#include <string>
+#include <vector>
+
+#include "../lista-vetor-strings/simd_string.h"
+#include "../lista-vetor-strings/string_list.h"
+
+namespace structures {
+
+//! Lista imutável de strings ordenadas com codificação por prefixo
+/*!
+  Construída a partir de uma ArrayListString ordenada. As strings são
+  agrupadas em baldes de bucket entradas: a primeira de cada balde é
+  guardada inteira, as demais só com o tamanho do prefixo em comum com
+  a anterior e o sufixo que sobra. find faz busca binária nas primeiras
+  strings dos baldes e decodifica um único balde.
+*/
+class FrontCodedList {
+ public:
+  //! Iterador (só leitura) que decodifica as strings em ordem
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string*;
+    using reference = const std::string&;
+
+    //! string atual
+    const std::string& operator*() const;
+    //! string atual
+    const std::string* operator->() const;
+    //! avança para a próxima string
+    Iterator& operator++();
+    //! avança para a próxima string
+    Iterator operator++(int);
+    //! compara posições
+    bool operator==(const Iterator& other) const;
+    //! compara posições
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    friend class FrontCodedList;
+    //! iterador na posição index, cujos bytes começam em offset
+    Iterator(const FrontCodedList* list, std::size_t index,
+             std::size_t offset);
+    //! decodifica a string da posição index_
+    void decode();
+    //! lista percorrida
+    const FrontCodedList* list_;
+    //! posição da string atual
+    std::size_t index_;
+    //! início dos bytes da próxima string a decodificar
+    std::size_t offset_;
+    //! string atual
+    std::string current_;
+  };
+
+  //! constrói a partir de uma lista ordenada (std::logic_error se não for)
+  explicit FrontCodedList(const ArrayListString& list,
+                          std::size_t bucket = DEFAULT_BUCKET);
+  //! verifica se contem elemento
+  bool contains(const char* data) const;
+  //! encontra elemento (size() se não encontrar)
+  std::size_t find(const char* data) const;
+  //! retorna elemento da posição com verificação
+  std::string at(std::size_t index) const;
+  //! retorna tamanho
+  std::size_t size() const;
+  //! verifica se está vazia
+  bool empty() const;
+  //! bytes ocupados pelas strings codificadas e pelos baldes
+  std::size_t memory() const;
+  //! primeira string
+  Iterator begin() const;
+  //! depois da última string
+  Iterator end() const;
+
+ private:
+  //! acrescenta value em base 128 (7 bits por byte)
+  void write_varint(std::size_t value);
+  //! lê um número em base 128 a partir de offset, avançando offset
+  std::size_t read_varint(std::size_t& offset) const;
+  //! bytes codificados
+  std::vector<char> data_;
+  //! início dos bytes de cada balde em data_
+  std::vector<std::size_t> buckets_;
+  //! strings por balde
+  std::size_t bucket_;
+  //! tamanho
+  std::size_t size_;
+  //! tamanho default do balde
+  static const std::size_t DEFAULT_BUCKET = 16u;
+};
+
+}  // namespace structures
+
+inline structures::FrontCodedList::FrontCodedList(
+    const ArrayListString& list, std::size_t bucket):
+  bucket_{bucket},
+  size_{list.size()}
+{
+  if (bucket == 0) {
+    throw std::out_of_range("Balde vazio");
+  }
+  if (!list.sorted()) {
+    throw std::logic_error("Lista não ordenada");
+  }
+  const char* previous = nullptr;
+  std::size_t previous_length = 0;
+  for (auto i = 0u; i < list.size(); i++) {
+    const char* current = list[i];
+    auto length = std::strlen(current);
+    std::size_t shared = 0;
+    if (i % bucket == 0) {
+      buckets_.push_back(data_.size());
+    } else {
+      shared = simd::mismatch(current, previous,
+                              std::min(length, previous_length));
+      write_varint(shared);
+    }
+    write_varint(length - shared);
+    data_.insert(data_.end(), current + shared, current + length);
+    previous = current;
+    previous_length = length;
+  }
+  data_.shrink_to_fit();
+  buckets_.shrink_to_fit();
+}
+
+inline bool structures::FrontCodedList::contains(const char* data) const {
+  return find(data) != size();
+}
+
+inline std::size_t structures::FrontCodedList::find(const char* data) const {
+  auto length = std::strlen(data);
+  // último balde cuja primeira string é < data: data, se existir, está
+  // nele ou é a primeira string do balde seguinte
+  std::size_t low = 0;
+  std::size_t high = buckets_.size();
+  while (low < high) {
+    auto middle = low + (high - low) / 2;
+    auto offset = buckets_[middle];
+    auto first_length = read_varint(offset);
+    if (simd::compare(data_.data() + offset, first_length, data, length) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  auto bucket = low == 0 ? 0 : low - 1;
+  for (auto it = Iterator(this, bucket * bucket_, empty() ? 0u :
+                          buckets_[bucket]); it != end(); ++it) {
+    auto order = simd::compare(it->data(), it->size(), data, length);
+    if (order == 0) {
+      return it.index_;
+    }
+    if (order > 0) {
+      break;
+    }
+  }
+  return size();
+}
+
+inline std::string structures::FrontCodedList::at(std::size_t index) const {
+  if (index >= size()) {
+    throw std::out_of_range("Index Out Of Range");
+  }
+  auto bucket = index / bucket_;
+  Iterator it(this, bucket * bucket_, buckets_[bucket]);
+  while (it.index_ < index) {
+    ++it;
+  }
+  return *it;
+}
+
+inline std::size_t structures::FrontCodedList::size() const {
+  return size_;
+}
+
+inline bool structures::FrontCodedList::empty() const {
+  return size() == 0u;
+}
+
+inline std::size_t structures::FrontCodedList::memory() const {
+  return data_.capacity() + buckets_.capacity() * sizeof(std::size_t);
+}
+
+inline structures::FrontCodedList::Iterator
+structures::FrontCodedList::begin() const {
+  return Iterator(this, 0u, 0u);
+}
+
+inline structures::FrontCodedList::Iterator
+structures::FrontCodedList::end() const {
+  return Iterator(this, size(), data_.size());
+}
+
+inline void structures::FrontCodedList::write_varint(std::size_t value) {
+  while (value >= 0x80) {
+    data_.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  data_.push_back(static_cast<char>(value));
+}
+
+inline std::size_t structures::FrontCodedList::read_varint(
+    std::size_t& offset) const {
+  std::size_t value = 0;
+  for (auto shift = 0u;; shift += 7) {
+    auto byte = static_cast<unsigned char>(data_[offset++]);
+    value |= static_cast<std::size_t>(byte & 0x7f) << shift;
+    if (byte < 0x80) {
+      return value;
+    }
+  }
+}
+
+inline structures::FrontCodedList::Iterator::Iterator(
+    const FrontCodedList* list, std::size_t index, std::size_t offset):
+  list_{list},
+  index_{index},
+  offset_{offset}
+{
+  if (index_ < list_->size()) {
+    decode();
+  }
+}
+
+inline const std::string&
+structures::FrontCodedList::Iterator::operator*() const {
+  return current_;
+}
+
+inline const std::string*
+structures::FrontCodedList::Iterator::operator->() const {
+  return &current_;
+}
+
+inline structures::FrontCodedList::Iterator&
+structures::FrontCodedList::Iterator::operator++() {
+  index_++;
+  if (index_ < list_->size()) {
+    decode();
+  }
+  return *this;
+}
+
+inline structures::FrontCodedList::Iterator
+structures::FrontCodedList::Iterator::operator++(int) {
+  auto copy = *this;
+  ++*this;
+  return copy;
+}
+
+inline bool structures::FrontCodedList::Iterator::operator==(
+    const Iterator& other) const {
+  return list_ == other.list_ && index_ == other.index_;
+}
+
+inline bool structures::FrontCodedList::Iterator::operator!=(
+    const Iterator& other) const {
+  return !(*this == other);
+}
+
+inline void structures::FrontCodedList::Iterator::decode() {
+  std::size_t shared = 0;
+  if (index_ % list_->bucket_ != 0) {
+    shared = list_->read_varint(offset_);
+  }
+  auto suffix = list_->read_varint(offset_);
+  current_.resize(shared);
+  current_.append(list_->data_.data() + offset_, suffix);
+  offset_ += suffix;
+}
+
+#endif
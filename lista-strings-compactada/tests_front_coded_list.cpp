@@ -0,0 +1,94 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "./front_coded_list.h"
+
+int main(int argc, char* argv[]) {
+    std::srand(std::time(NULL));
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+class FrontCodedListTest: public ::testing::Test {
+ protected:
+    void SetUp() {
+        const char *paths[] = {"", "/usr", "/usr/bin", "/usr/bin/g++",
+            "/usr/bin/gcc", "/usr/lib", "/usr/lib/libc.so",
+            "/usr/lib/libc.so.6", "/usr/lib/libm.so", "/var", "/var/log",
+            "/var/log/syslog", "\xc3\xa9"};
+        for (auto path : paths) {
+            list.push_back(path);
+            expected.push_back(path);
+        }
+    }
+
+    structures::ArrayListString list{20u};
+    std::vector<std::string> expected;
+};
+
+TEST_F(FrontCodedListTest, Iteration) {
+    for (auto bucket : {1u, 2u, 3u, 16u}) {
+        structures::FrontCodedList frozen{list, bucket};
+        ASSERT_EQ(expected.size(), frozen.size());
+        std::vector<std::string> decoded(frozen.begin(), frozen.end());
+        ASSERT_EQ(expected, decoded);
+    }
+}
+
+TEST_F(FrontCodedListTest, FindAndContains) {
+    for (auto bucket : {1u, 2u, 3u, 16u}) {
+        structures::FrontCodedList frozen{list, bucket};
+        for (auto i = 0u; i < expected.size(); ++i) {
+            ASSERT_EQ(i, frozen.find(expected[i].c_str()));
+            ASSERT_EQ(expected[i], frozen.at(i));
+        }
+        for (auto absent : {"/", "/usr/bi", "/usr/bin/", "/usr/lib/libc",
+                            "/var/log/syslog2", "/zzz", "\xc3"}) {
+            ASSERT_EQ(frozen.size(), frozen.find(absent));
+            ASSERT_FALSE(frozen.contains(absent));
+        }
+        ASSERT_TRUE(frozen.contains("/usr/lib/libm.so"));
+        ASSERT_THROW(frozen.at(frozen.size()), std::out_of_range);
+    }
+}
+
+TEST_F(FrontCodedListTest, Duplicates) {
+    structures::ArrayListString repeated{10u};
+    for (auto data : {"a", "b", "b", "b", "c"}) {
+        repeated.push_back(data);
+    }
+    structures::FrontCodedList frozen{repeated, 2u};
+    ASSERT_EQ(1u, frozen.find("b"));
+    ASSERT_EQ(4u, frozen.find("c"));
+}
+
+TEST_F(FrontCodedListTest, EmptyList) {
+    structures::ArrayListString empty{1u};
+    structures::FrontCodedList frozen{empty};
+    ASSERT_TRUE(frozen.empty());
+    ASSERT_TRUE(frozen.begin() == frozen.end());
+    ASSERT_EQ(0u, frozen.find("a"));
+}
+
+TEST_F(FrontCodedListTest, RequiresSortedList) {
+    ASSERT_THROW(structures::FrontCodedList(list, 0u), std::out_of_range);
+    list.push_back("/aaa");
+    ASSERT_THROW(structures::FrontCodedList{list}, std::logic_error);
+}
+
+TEST_F(FrontCodedListTest, SavesMemoryOnSharedPrefixes) {
+    structures::ArrayListString urls{1000u};
+    std::size_t bytes = 0;
+    for (auto i = 0; i < 1000; ++i) {
+        auto url = "https://www.example.com/produtos/" + std::to_string(i);
+        urls.insert_sorted(url.c_str());
+        bytes += url.size() + 1;
+    }
+    structures::FrontCodedList frozen{urls};
+    ASSERT_LT(frozen.memory(), bytes / 3);
+    auto it = frozen.begin();
+    for (auto i = 0u; i < urls.size(); ++i, ++it) {
+        ASSERT_STREQ(urls[i], it->c_str());
+    }
+}
@@ -0,0 +1,277 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_SORTED_ARRAY_LIST_H
+#define STRUCTURES_SORTED_ARRAY_LIST_H
+
+#include <cstdint>
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move, std::pair
+
+#include "../lista-vetor/array_list.h"
+
+namespace structures {
+
+template<typename T, typename Allocator = std::allocator<T>>
+//! Lista em vetor mantida sempre em ordem, com buscas binárias
+class SortedArrayList {
+ public:
+  //! construtor simples
+  SortedArrayList();
+  //! construtor parametrizado
+  explicit SortedArrayList(std::size_t max_size);
+  //! construtor simples, vetor base reservado com allocator
+  explicit SortedArrayList(const Allocator& allocator);
+  //! construtor parametrizado, vetor base reservado com allocator
+  SortedArrayList(std::size_t max_size, const Allocator& allocator);
+  //! limpa lista
+  void clear();
+  //! adiciona em ordem
+  void insert_sorted(const T& data);
+  //! adiciona em ordem, movendo o dado
+  void insert_sorted(T&& data);
+  //! retira da posição
+  T pop(std::size_t index);
+  //! retira do final (maior elemento)
+  T pop_back();
+  //! retira da frente (menor elemento)
+  T pop_front();
+  //! retira dado específico
+  void remove(const T& data);
+  //! verifica se está cheia
+  bool full() const;
+  //! verifica se está vazia
+  bool empty() const;
+  //! verifica se contem elemento
+  bool contains(const T& data) const;
+  //! encontra elemento (size() se não encontrar)
+  std::size_t find(const T& data) const;
+  //! primeira posição com elemento >= data
+  std::size_t lower_bound(const T& data) const;
+  //! primeira posição com elemento > data
+  std::size_t upper_bound(const T& data) const;
+  //! posições [primeira, última) dos elementos em [low, high]
+  std::pair<std::size_t, std::size_t> range(const T& low,
+                                            const T& high) const;
+  //! quantidade de elementos em [low, high]
+  std::size_t count(const T& low, const T& high) const;
+  //! retorna tamanho
+  std::size_t size() const;
+  //! retorna tamanho máximo
+  std::size_t max_size() const;
+  //! retorna elemento da posição com verificação
+  const T& at(std::size_t index) const;
+  //! retorna elemento da posição
+  const T& operator[](std::size_t index) const;
+  //! iterador de acesso aleatório, só leitura (a ordem é da lista)
+  using ConstIterator = const T*;
+  //! primeiro elemento
+  ConstIterator begin() const;
+  //! depois do último elemento
+  ConstIterator end() const;
+  //! primeiro elemento
+  ConstIterator cbegin() const;
+  //! depois do último elemento
+  ConstIterator cend() const;
+
+ private:
+  //! lista base, sempre ordenada
+  ArrayList<T, Allocator> list_;
+};
+
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! SortedArrayList com vetor base em um std::pmr::memory_resource
+template<typename T>
+using SortedArrayList =
+    structures::SortedArrayList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::SortedArrayList<T, Allocator>::SortedArrayList():
+  list_{}
+{}
+
+template<typename T, typename Allocator>
+structures::SortedArrayList<T, Allocator>::SortedArrayList(
+    std::size_t max_size):
+  list_{max_size}
+{}
+
+template<typename T, typename Allocator>
+structures::SortedArrayList<T, Allocator>::SortedArrayList(
+    const Allocator& allocator):
+  list_{allocator}
+{}
+
+template<typename T, typename Allocator>
+structures::SortedArrayList<T, Allocator>::SortedArrayList(
+    std::size_t max_size, const Allocator& allocator):
+  list_{max_size, allocator}
+{}
+
+template<typename T, typename Allocator>
+void structures::SortedArrayList<T, Allocator>::clear() {
+  list_.clear();
+}
+
+template<typename T, typename Allocator>
+void structures::SortedArrayList<T, Allocator>::insert_sorted(const T& data) {
+  insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::SortedArrayList<T, Allocator>::insert_sorted(T&& data) {
+  if (full()) {
+    throw std::out_of_range("Lista cheia");
+  }
+  auto index = upper_bound(data);
+  list_.insert(std::move(data), index);
+}
+
+template<typename T, typename Allocator>
+T structures::SortedArrayList<T, Allocator>::pop(std::size_t index) {
+  return list_.pop(index);
+}
+
+template<typename T, typename Allocator>
+T structures::SortedArrayList<T, Allocator>::pop_back() {
+  return list_.pop_back();
+}
+
+template<typename T, typename Allocator>
+T structures::SortedArrayList<T, Allocator>::pop_front() {
+  return list_.pop_front();
+}
+
+template<typename T, typename Allocator>
+void structures::SortedArrayList<T, Allocator>::remove(const T& data) {
+  pop(find(data));
+}
+
+template<typename T, typename Allocator>
+bool structures::SortedArrayList<T, Allocator>::full() const {
+  return list_.full();
+}
+
+template<typename T, typename Allocator>
+bool structures::SortedArrayList<T, Allocator>::empty() const {
+  return list_.empty();
+}
+
+template<typename T, typename Allocator>
+bool structures::SortedArrayList<T, Allocator>::contains(const T& data) const {
+  return find(data) != size();
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SortedArrayList<T, Allocator>::find(
+    const T& data) const {
+  auto index = lower_bound(data);
+  if (index < size() && list_[index] == data) {
+    return index;
+  }
+  return size();
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SortedArrayList<T, Allocator>::lower_bound(
+    const T& data) const {
+  std::size_t begin = 0;
+  std::size_t end = size();
+  while (begin < end) {
+    auto middle = begin + (end - begin) / 2;
+    if (data > list_[middle]) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SortedArrayList<T, Allocator>::upper_bound(
+    const T& data) const {
+  std::size_t begin = 0;
+  std::size_t end = size();
+  while (begin < end) {
+    auto middle = begin + (end - begin) / 2;
+    if (list_[middle] > data) {
+      end = middle;
+    } else {
+      begin = middle + 1;
+    }
+  }
+  return begin;
+}
+
+template<typename T, typename Allocator>
+std::pair<std::size_t, std::size_t>
+structures::SortedArrayList<T, Allocator>::range(
+    const T& low, const T& high) const {
+  auto first = lower_bound(low);
+  auto last = upper_bound(high);
+  if (last < first) {
+    last = first;
+  }
+  return {first, last};
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SortedArrayList<T, Allocator>::count(const T& low,
+                                                  const T& high) const {
+  auto bounds = range(low, high);
+  return bounds.second - bounds.first;
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SortedArrayList<T, Allocator>::size() const {
+  return list_.size();
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::SortedArrayList<T, Allocator>::max_size() const {
+  return list_.max_size();
+}
+
+template<typename T, typename Allocator>
+const T& structures::SortedArrayList<T, Allocator>::at(
+    std::size_t index) const {
+  return list_.at(index);
+}
+
+template<typename T, typename Allocator>
+const T& structures::SortedArrayList<T, Allocator>::operator[](
+    std::size_t index) const {
+  return list_[index];
+}
+
+template<typename T, typename Allocator>
+typename structures::SortedArrayList<T, Allocator>::ConstIterator
+structures::SortedArrayList<T, Allocator>::begin() const {
+  return list_.begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::SortedArrayList<T, Allocator>::ConstIterator
+structures::SortedArrayList<T, Allocator>::end() const {
+  return list_.end();
+}
+
+template<typename T, typename Allocator>
+typename structures::SortedArrayList<T, Allocator>::ConstIterator
+structures::SortedArrayList<T, Allocator>::cbegin() const {
+  return begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::SortedArrayList<T, Allocator>::ConstIterator
+structures::SortedArrayList<T, Allocator>::cend() const {
+  return end();
+}
+
+#endif
@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+#include "sorted_array_list.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+int main(int argc, char* argv[]) {
+    std::srand(std::time(NULL));
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+class SortedArrayListTest: public ::testing::Test {
+protected:
+    structures::SortedArrayList<int> list{10u};
+};
+
+
+TEST_F(SortedArrayListTest, DefaultConstructor) {
+    structures::SortedArrayList<int> other;
+    ASSERT_EQ(10u, other.max_size());
+    ASSERT_TRUE(other.empty());
+}
+
+TEST_F(SortedArrayListTest, InsertSorted) {
+    for (auto i : {5, 3, 9, 1, 7, 3, 0}) {
+        list.insert_sorted(i);
+    }
+    ASSERT_EQ(7u, list.size());
+    for (auto i = 1u; i < list.size(); ++i) {
+        ASSERT_FALSE(list[i - 1] > list[i]);
+    }
+    ASSERT_EQ(0, list[0]);
+    ASSERT_EQ(9, list[6]);
+}
+
+TEST_F(SortedArrayListTest, InsertSortedBoundCheck) {
+    for (auto i = 0; i < 10; ++i) {
+        list.insert_sorted(i);
+    }
+    ASSERT_TRUE(list.full());
+    ASSERT_THROW(list.insert_sorted(0), std::out_of_range);
+}
+
+TEST_F(SortedArrayListTest, FindAndContains) {
+    for (auto i = 0; i < 10; ++i) {
+        list.insert_sorted(2 * i);
+    }
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(i, list.find(2 * i));
+        ASSERT_TRUE(list.contains(2 * i));
+        ASSERT_FALSE(list.contains(2 * i + 1));
+        ASSERT_EQ(list.size(), list.find(2 * i + 1));
+    }
+    ASSERT_EQ(list.size(), list.find(-1));
+}
+
+TEST_F(SortedArrayListTest, Bounds) {
+    for (auto i : {1, 2, 2, 2, 4, 6}) {
+        list.insert_sorted(i);
+    }
+    ASSERT_EQ(1u, list.lower_bound(2));
+    ASSERT_EQ(4u, list.upper_bound(2));
+    ASSERT_EQ(4u, list.lower_bound(3));
+    ASSERT_EQ(4u, list.upper_bound(3));
+    ASSERT_EQ(0u, list.lower_bound(0));
+    ASSERT_EQ(6u, list.upper_bound(6));
+}
+
+TEST_F(SortedArrayListTest, Range) {
+    for (auto i = 0; i < 10; ++i) {
+        list.insert_sorted(i * 10);
+    }
+    auto bounds = list.range(15, 45);
+    ASSERT_EQ(2u, bounds.first);
+    ASSERT_EQ(5u, bounds.second);
+    ASSERT_EQ(3u, list.count(15, 45));
+    ASSERT_EQ(10u, list.count(0, 90));
+    ASSERT_EQ(0u, list.count(91, 100));
+    ASSERT_EQ(0u, list.count(50, 40));
+}
+
+TEST_F(SortedArrayListTest, Remove) {
+    for (auto i = 0; i < 10; ++i) {
+        list.insert_sorted(i);
+    }
+    list.remove(4);
+    ASSERT_EQ(9u, list.size());
+    ASSERT_FALSE(list.contains(4));
+    ASSERT_THROW(list.remove(4), std::out_of_range);
+    ASSERT_EQ(0, list.pop_front());
+    ASSERT_EQ(9, list.pop_back());
+    ASSERT_EQ(5, list.pop(3));
+}
+
+TEST(SortedArrayListStringTest, Strings) {
+    structures::SortedArrayList<std::string> list{10u};
+    for (auto city : {"Lages", "Blumenau", "Joinville", "Chapeco"}) {
+        list.insert_sorted(std::string(city));
+    }
+    ASSERT_EQ("Blumenau", list.at(0));
+    ASSERT_EQ("Lages", list.at(3));
+    ASSERT_EQ(2u, list.find("Joinville"));
+    ASSERT_EQ(2u, list.count("C", "K"));
+}
+
+#if __cplusplus >= 201703L
+TEST(SortedArrayListPmrTest, ContentsInOneAllocation) {
+    // o vetor é reservado inteiro no construtor: 64 ints cabem em um
+    // buffer de 64 ints, e sem memória a falha vem na construção
+    alignas(std::max_align_t) char buffer[64 * sizeof(int)];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    {
+        structures::pmr::SortedArrayList<int> container{64u, &resource};
+        for (auto i = 0; i < 64; i++) {
+            container.insert_sorted(i);
+        }
+        ASSERT_TRUE(container.full());
+        for (auto i = 0; i < 64; i++) {
+            ASSERT_EQ(i, container.pop_front());
+        }
+        ASSERT_TRUE(container.empty());
+    }
+    using Container = structures::pmr::SortedArrayList<int>;
+    ASSERT_THROW(Container(1u, &resource), std::bad_alloc);
+}
+#endif
+
+TEST_F(SortedArrayListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto data : {5, 1, 4, 2, 3}) {
+        list.insert_sorted(data);
+    }
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 5}),
+              std::vector<int>(list.begin(), list.end()));
+    ASSERT_TRUE(std::binary_search(list.begin(), list.end(), 4));
+    ASSERT_EQ(2, std::lower_bound(list.begin(), list.end(), 3) - list.begin());
+}
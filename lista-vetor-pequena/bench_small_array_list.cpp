@@ -0,0 +1,77 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de listas pequenas e de vida curta: ArrayList x SmallArrayList.
+// Compilar: g++ -O2 -std=c++14 bench_small_array_list.cpp -o bench_small
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "../lista-vetor/array_list.h"
+#include "small_array_list.h"
+
+//! Quantidade de alocações feitas pelo programa
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  if (void* pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Cria, preenche com n elementos, consulta e destrói a lista
+template<typename List>
+void bench(const char* name, std::size_t n) {
+  const auto repetitions = 1000000u;
+  volatile std::size_t sink = 0;
+  auto before = allocations;
+  auto time = measure([&] {
+    for (auto r = 0u; r < repetitions; r++) {
+      List list(32u);
+      for (auto i = 0u; i < n; i++) {
+        list.push_back(static_cast<int>(r + i));
+      }
+      sink = sink + list.find(static_cast<int>(r + n / 2)) + list.pop_front();
+    }
+  });
+  std::printf("%-24s n=%-3zu %8.2f ns/lista  %6.2f alocações/lista\n",
+              name, n, time * 1e6 / repetitions,
+              static_cast<double>(allocations - before) / repetitions);
+}
+
+int main() {
+  for (auto n : {4u, 8u, 16u, 24u}) {
+    bench<structures::ArrayList<int>>("ArrayList<int>", n);
+    bench<structures::SmallArrayList<int, 16>>("SmallArrayList<int, 16>", n);
+  }
+  return 0;
+}
@@ -0,0 +1,484 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_SMALL_ARRAY_LIST_H
+#define STRUCTURES_SMALL_ARRAY_LIST_H
+
+#include <algorithm>  // std::move, std::move_backward
+#include <cstdint>
+#include <cstring>  // std::memmove
+#include <new>  // placement new, ::operator new
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_trivially_copyable
+#include <utility>  // std::move, std::forward
+
+#include "../lista-vetor/simd_find.h"
+
+namespace structures {
+
+template<typename T, std::size_t N = 16>
+//! Lista em vetor que guarda até N elementos sem alocar
+/*!
+  Os primeiros N elementos ficam em um vetor interno ao objeto; só quando
+  a lista passa de N elementos o conteúdo é movido para um vetor de
+  max_size() posições no heap. Os dois vetores são memória crua: só as
+  posições ocupadas têm um T construído, então T não precisa de
+  construtor padrão. Tem a interface básica de ArrayList (inserção,
+  retirada, busca, acesso e iteradores), mas não sort, count_if, reduce,
+  for_each nem alocador.
+*/
+class SmallArrayList {
+ public:
+  //! construtor simples
+  SmallArrayList();
+  //! construtor parametrizado
+  explicit SmallArrayList(std::size_t max_size);
+  //! não copiável: contents pode apontar para o vetor interno
+  SmallArrayList(const SmallArrayList&) = delete;
+  //! não copiável
+  SmallArrayList& operator=(const SmallArrayList&) = delete;
+  //! destrutor
+  ~SmallArrayList();
+  //! limpa lista
+  void clear();
+  //! adiciona ao final
+  void push_back(const T& data);
+  //! adiciona ao final, movendo o dado
+  void push_back(T&& data);
+  //! adiciona à frente
+  void push_front(const T& data);
+  //! adiciona à frente, movendo o dado
+  void push_front(T&& data);
+  //! adiciona na posição
+  void insert(const T& data, std::size_t index);
+  //! adiciona na posição, movendo o dado
+  void insert(T&& data, std::size_t index);
+  //! adiciona em ordem
+  void insert_sorted(const T& data);
+  //! adiciona em ordem, movendo o dado
+  void insert_sorted(T&& data);
+  //! constrói ao final
+  template<typename... Args>
+  void emplace_back(Args&&... args);
+  //! constrói à frente
+  template<typename... Args>
+  void emplace_front(Args&&... args);
+  //! constrói na posição
+  template<typename... Args>
+  void emplace(std::size_t index, Args&&... args);
+  //! retira da posição
+  T pop(std::size_t index);
+  //! retira do final
+  T pop_back();
+  //! retira da frente
+  T pop_front();
+  //! retira dado específico
+  void remove(const T& data);
+  //! verifica se está cheia
+  bool full() const;
+  //! verifica se está vazia
+  bool empty() const;
+  //! verifica se contem elemento
+  bool contains(const T& data) const;
+  //! encontra elemento
+  std::size_t find(const T& data) const;
+  //! retorna tamanho
+  std::size_t size() const;
+  //! retorna tamanho máximo
+  std::size_t max_size() const;
+  //! verifica se os elementos ainda estão no vetor interno
+  bool is_inline() const;
+  //! retorna elemento da posição com verificação
+  T& at(std::size_t index);
+  //! retorna elemento da posição
+  T& operator[](std::size_t index);
+  //! retorna elemento da posição com verificação
+  const T& at(std::size_t index) const;
+  //! retorna elemento da posição com verificação
+  const T& operator[](std::size_t index) const;
+  //! iterador de acesso aleatório
+  using Iterator = T*;
+  //! iterador de acesso aleatório, só leitura
+  using ConstIterator = const T*;
+  //! primeiro elemento
+  Iterator begin();
+  //! depois do último elemento
+  Iterator end();
+  //! primeiro elemento, só leitura
+  ConstIterator begin() const;
+  //! depois do último elemento, só leitura
+  ConstIterator end() const;
+  //! primeiro elemento, só leitura
+  ConstIterator cbegin() const;
+  //! depois do último elemento, só leitura
+  ConstIterator cend() const;
+
+ private:
+  //! verifica sucessor
+  bool successor(const T& data1, const T& data2);
+  //! garante espaço para mais um elemento, indo para o heap se preciso
+  void reserve_one();
+  //! move count elementos de src para dest (faixas podem se sobrepor)
+  void move_range(std::size_t dest, std::size_t src, std::size_t count);
+  //! move_range para T trivialmente copiável: um único memmove
+  void move_range(std::size_t dest, std::size_t src, std::size_t count,
+                  std::true_type);
+  //! move_range para os demais T: atribuição por movimento
+  void move_range(std::size_t dest, std::size_t src, std::size_t count,
+                  std::false_type);
+  //! find para T aritmético: kernel vetorizado
+  std::size_t find(const T& data, std::true_type) const;
+  //! find para os demais T: laço com operator==
+  std::size_t find(const T& data, std::false_type) const;
+  //! início do vetor interno
+  T* inline_contents();
+  //! início do vetor interno, só leitura
+  const T* inline_contents() const;
+  //! vetor interno, sem nenhum T construído de antemão
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+  //! vetor base: buffer_ ou vetor no heap
+  T* contents;
+  //! tamanho
+  std::size_t size_;
+  //! tamanho máximo
+  std::size_t max_size_;
+  //! tamanho default
+  static const auto DEFAULT_MAX = 10u;
+  static_assert(N > 0, "SmallArrayList precisa de N > 0");
+};
+
+}  // namespace structures
+
+template<typename T, std::size_t N>
+structures::SmallArrayList<T, N>::SmallArrayList(std::size_t max_size) {
+  size_ = 0;
+  max_size_ = max_size;
+  contents = inline_contents();
+}
+
+template<typename T, std::size_t N>
+structures::SmallArrayList<T, N>::SmallArrayList():
+  SmallArrayList(std::size_t(DEFAULT_MAX))
+{}
+
+template<typename T, std::size_t N>
+structures::SmallArrayList<T, N>::~SmallArrayList() {
+  clear();
+  if (!is_inline()) {
+    ::operator delete(contents);
+  }
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::clear() {
+  for (auto i = 0u; i < size_; i++) {
+    contents[i].~T();
+  }
+  size_ = 0;
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::push_back(const T& data) {
+  emplace_back(data);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::push_front(const T& data) {
+  emplace_front(data);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::insert(const T& data,
+                                              std::size_t index) {
+  emplace(index, data);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::insert(T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::insert_sorted(const T& data) {
+  insert_sorted(T(data));
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::insert_sorted(T&& data) {
+  if (full()) {
+    throw std::out_of_range("Lista cheia");
+  }
+  // busca binária pela primeira posição que não antecede data
+  std::size_t pos = 0;
+  std::size_t end = size_;
+  while (pos < end) {
+    auto middle = pos + (end - pos) / 2;
+    if (successor(data, contents[middle])) {
+      pos = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  insert(std::move(data), pos);
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+void structures::SmallArrayList<T, N>::emplace_back(Args&&... args) {
+  if (full()) {
+    throw std::out_of_range("Lista cheia");
+  }
+  T data(std::forward<Args>(args)...);
+  reserve_one();
+  new (contents + size_) T(std::move(data));
+  size_ += 1;
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+void structures::SmallArrayList<T, N>::emplace_front(Args&&... args) {
+  emplace(0u, std::forward<Args>(args)...);
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+void structures::SmallArrayList<T, N>::emplace(std::size_t index,
+                                               Args&&... args) {
+  if (full()) {
+    throw std::out_of_range("Lista cheia");
+  }
+  if (index > size()) {
+    throw std::out_of_range("Index Out of Range");
+  }
+  // constrói antes de deslocar: args pode referenciar um elemento da lista
+  T data(std::forward<Args>(args)...);
+  reserve_one();
+  if (index == size()) {
+    new (contents + size_) T(std::move(data));
+  } else {
+    // a posição depois do último ainda é crua: o último é construído
+    // nela e os demais são deslocados por atribuição
+    new (contents + size_) T(std::move(contents[size_ - 1]));
+    move_range(index + 1, index, size() - index - 1);
+    contents[index] = std::move(data);
+  }
+  size_ += 1;
+}
+
+template<typename T, std::size_t N>
+T structures::SmallArrayList<T, N>::pop(std::size_t index) {
+  if (index >= size()) {
+    throw std::out_of_range("Index Out Of Range");
+  }
+  auto data = std::move(contents[index]);
+  move_range(index, index + 1, size() - index - 1);
+  size_ -= 1;
+  contents[size_].~T();
+  return data;
+}
+
+template<typename T, std::size_t N>
+T structures::SmallArrayList<T, N>::pop_back() {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  size_ -= 1;
+  auto data = std::move(contents[size_]);
+  contents[size_].~T();
+  return data;
+}
+
+template<typename T, std::size_t N>
+T structures::SmallArrayList<T, N>::pop_front() {
+  if (empty()) {
+    throw std::out_of_range("Lista vazia");
+  }
+  return pop(0u);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::remove(const T& data) {
+  auto index = find(data);
+  pop(index);
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayList<T, N>::full() const {
+  return size_ == max_size_;
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayList<T, N>::empty() const {
+  return size() == 0u;
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayList<T, N>::contains(const T& data) const {
+  return find(data) != size();
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayList<T, N>::find(const T& data) const {
+  return find(data, simd::has_find<T>());
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayList<T, N>::find(
+    const T& data, std::true_type) const {
+  return simd::find(contents, size(), data);
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayList<T, N>::find(
+    const T& data, std::false_type) const {
+  auto index = size();
+  for (auto i = 0u; i < size(); i++) {
+    if (contents[i] == data) {
+      index = i;
+      break;
+    }
+  }
+  return index;
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayList<T, N>::size() const {
+  return size_;
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayList<T, N>::max_size() const {
+  return max_size_;
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayList<T, N>::is_inline() const {
+  return contents == inline_contents();
+}
+
+template<typename T, std::size_t N>
+T& structures::SmallArrayList<T, N>::at(std::size_t index) {
+  if (index >= size()) {
+    throw std::out_of_range("Index Out Of Range");
+  }
+  return contents[index];
+}
+
+template<typename T, std::size_t N>
+const T& structures::SmallArrayList<T, N>::at(std::size_t index) const {
+  if (index >= size()) {
+    throw std::out_of_range("Index Out Of Range");
+  }
+  return contents[index];
+}
+
+template<typename T, std::size_t N>
+T& structures::SmallArrayList<T, N>::operator[](std::size_t index) {
+  return contents[index];
+}
+
+template<typename T, std::size_t N>
+const T& structures::SmallArrayList<T, N>::operator[](
+    std::size_t index) const {
+  return contents[index];
+}
+
+template<typename T, std::size_t N>
+typename structures::SmallArrayList<T, N>::Iterator
+structures::SmallArrayList<T, N>::begin() {
+  return contents;
+}
+
+template<typename T, std::size_t N>
+typename structures::SmallArrayList<T, N>::Iterator
+structures::SmallArrayList<T, N>::end() {
+  return contents + size_;
+}
+
+template<typename T, std::size_t N>
+typename structures::SmallArrayList<T, N>::ConstIterator
+structures::SmallArrayList<T, N>::begin() const {
+  return contents;
+}
+
+template<typename T, std::size_t N>
+typename structures::SmallArrayList<T, N>::ConstIterator
+structures::SmallArrayList<T, N>::end() const {
+  return contents + size_;
+}
+
+template<typename T, std::size_t N>
+typename structures::SmallArrayList<T, N>::ConstIterator
+structures::SmallArrayList<T, N>::cbegin() const {
+  return begin();
+}
+
+template<typename T, std::size_t N>
+typename structures::SmallArrayList<T, N>::ConstIterator
+structures::SmallArrayList<T, N>::cend() const {
+  return end();
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayList<T, N>::successor(const T& data1,
+                                                 const T& data2) {
+  return data1 > data2;
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::reserve_one() {
+  if (!is_inline() || size_ < N) {
+    return;
+  }
+  auto heap = static_cast<T*>(::operator new(max_size_ * sizeof(T)));
+  for (auto i = 0u; i < size_; i++) {
+    new (heap + i) T(std::move(contents[i]));
+    contents[i].~T();
+  }
+  contents = heap;
+}
+
+template<typename T, std::size_t N>
+T* structures::SmallArrayList<T, N>::inline_contents() {
+  return reinterpret_cast<T*>(buffer_);
+}
+
+template<typename T, std::size_t N>
+const T* structures::SmallArrayList<T, N>::inline_contents() const {
+  return reinterpret_cast<const T*>(buffer_);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::move_range(
+    std::size_t dest, std::size_t src, std::size_t count) {
+  move_range(dest, src, count, std::is_trivially_copyable<T>());
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::move_range(
+    std::size_t dest, std::size_t src, std::size_t count, std::true_type) {
+  if (count > 0) {
+    std::memmove(contents + dest, contents + src, count * sizeof(T));
+  }
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayList<T, N>::move_range(
+    std::size_t dest, std::size_t src, std::size_t count, std::false_type) {
+  if (dest < src) {
+    std::move(contents + src, contents + src + count, contents + dest);
+  } else {
+    std::move_backward(contents + src, contents + src + count,
+                       contents + dest + count);
+  }
+}
+
+#endif
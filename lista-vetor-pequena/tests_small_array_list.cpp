@@ -0,0 +1,206 @@
+#include "gtest/gtest.h"
+#include "small_array_list.h"
+
+#include <memory>
+#include <numeric>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    std::srand(std::time(NULL));
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+// sem construtor padrão, contando quantos objetos estão vivos
+struct Counted {
+    explicit Counted(int value): value{value} { alive++; }
+    Counted(const Counted& other): value{other.value} { alive++; }
+    Counted(Counted&& other): value{other.value} { alive++; }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+    ~Counted() { alive--; }
+    bool operator==(const Counted& other) const {
+        return value == other.value;
+    }
+    int value;
+    static int alive;
+};
+int Counted::alive = 0;
+}  // namespace
+
+class SmallArrayListTest: public ::testing::Test {
+protected:
+    structures::SmallArrayList<int, 4> list{10u};
+};
+
+
+TEST_F(SmallArrayListTest, DefaultConstructor) {
+    structures::SmallArrayList<int> other;
+    ASSERT_EQ(10u, other.max_size());
+    ASSERT_TRUE(other.empty());
+    ASSERT_TRUE(other.is_inline());
+}
+
+TEST_F(SmallArrayListTest, StaysInlineUpToN) {
+    for (auto i = 0; i < 4; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_TRUE(list.is_inline());
+    list.push_back(4);
+    ASSERT_FALSE(list.is_inline());
+    for (auto i = 0u; i < 5u; ++i) {
+        ASSERT_EQ(i, list[i]);
+    }
+}
+
+TEST_F(SmallArrayListTest, PushBack) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(10u, list.size());
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(i, list[i]);
+    }
+    ASSERT_TRUE(list.full());
+    ASSERT_THROW(list.push_back(10), std::out_of_range);
+}
+
+TEST_F(SmallArrayListTest, PushFront) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_front(i);
+    }
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(9 - i, list[i]);
+    }
+    ASSERT_THROW(list.push_front(11), std::out_of_range);
+}
+
+TEST_F(SmallArrayListTest, Insert) {
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+    }
+    for (auto i = 6; i < 10; ++i) {
+        list.push_back(i);
+    }
+    list.insert(5, 5u);
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list[i]);
+    }
+    ASSERT_THROW(list.insert(1, 11u), std::out_of_range);
+}
+
+TEST_F(SmallArrayListTest, InsertInOrder) {
+    for (auto i = 9; i >= 0; --i) {
+        list.insert_sorted(i);
+    }
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, list[i]);
+    }
+}
+
+TEST_F(SmallArrayListTest, Pop) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(5, list.pop(5));
+    ASSERT_EQ(0, list.pop_front());
+    ASSERT_EQ(9, list.pop_back());
+    ASSERT_EQ(7u, list.size());
+    ASSERT_THROW(list.pop(7), std::out_of_range);
+    list.clear();
+    ASSERT_THROW(list.pop_back(), std::out_of_range);
+    ASSERT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST_F(SmallArrayListTest, FindContainsRemove) {
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(3u, list.find(3));
+    ASSERT_EQ(list.size(), list.find(10));
+    list.remove(4);
+    ASSERT_FALSE(list.contains(4));
+    ASSERT_TRUE(list.contains(9));
+}
+
+TEST_F(SmallArrayListTest, AccessAt) {
+    list.push_back(1);
+    ASSERT_EQ(1, list.at(0));
+    ASSERT_THROW(list.at(1), std::out_of_range);
+}
+
+TEST(SmallArrayListMoveTest, SpillMovesStrings) {
+    // ao sair do vetor interno, cada string é construída por movimento no
+    // vetor do heap e leva o seu buffer junto
+    structures::SmallArrayList<std::string, 2> list{10u};
+    list.emplace_back(40u, 'a');
+    list.emplace_back(40u, 'b');
+    auto a = list[0].data();
+    auto b = list[1].data();
+    ASSERT_TRUE(list.is_inline());
+    list.emplace(1u, 40u, 'c');
+    ASSERT_FALSE(list.is_inline());
+    ASSERT_EQ(a, list[0].data());
+    ASSERT_EQ(std::string(40u, 'c'), list[1]);
+    ASSERT_EQ(b, list[2].data());
+    ASSERT_EQ(b, list.pop_back().data());
+}
+
+TEST(SmallArrayListMoveTest, SpillMoveOnly) {
+    // a passagem para o heap acontece no meio de um emplace_front, que
+    // ainda desloca os dois elementos movidos
+    structures::SmallArrayList<std::unique_ptr<int>, 2> list{10u};
+    auto zero = new int(0);
+    auto one = new int(1);
+    list.emplace_front(one);
+    list.emplace_front(zero);
+    ASSERT_TRUE(list.is_inline());
+    list.emplace_front(new int(-1));
+    ASSERT_FALSE(list.is_inline());
+    ASSERT_EQ(zero, list[1].get());
+    ASSERT_EQ(one, list[2].get());
+    ASSERT_EQ(-1, *list.pop_front());
+    ASSERT_EQ(one, list.pop_back().get());
+    ASSERT_EQ(zero, list.pop_back().get());
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(SmallArrayListStorageTest, ConstructsOnlyStoredElements) {
+    {
+        structures::SmallArrayList<Counted, 4> list{8u};
+        ASSERT_EQ(0, Counted::alive);
+        for (auto i = 0; i < 3; ++i) {
+            list.emplace_back(i);
+        }
+        ASSERT_EQ(3, Counted::alive);
+        list.emplace(1u, 10);
+        list.emplace_front(20);  // passa para o heap
+        ASSERT_FALSE(list.is_inline());
+        ASSERT_EQ(5, Counted::alive);
+        ASSERT_EQ(10, list.pop(2).value);
+        ASSERT_EQ(20, list.pop_front().value);
+        ASSERT_EQ(2, list.pop_back().value);
+        ASSERT_EQ(2, Counted::alive);
+        ASSERT_EQ(0, list[0].value);
+        ASSERT_EQ(1, list[1].value);
+        list.clear();
+        ASSERT_EQ(0, Counted::alive);
+        list.emplace_back(7);
+    }
+    ASSERT_EQ(0, Counted::alive);
+}
+
+TEST_F(SmallArrayListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto i = 0; i < 8; ++i) {
+        list.push_back(i);
+        // percorre tanto o vetor interno quanto o do heap
+        ASSERT_EQ(i * (i + 1) / 2,
+                  std::accumulate(list.begin(), list.end(), 0));
+    }
+    for (auto& data : list) {
+        data = -data;
+    }
+    ASSERT_EQ(-7, list[7]);
+}
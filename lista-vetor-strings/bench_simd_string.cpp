@@ -0,0 +1,81 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Microbenchmark de comparação de strings: kernels simd x memcmp x strcmp.
+// Compilar: g++ -O2 -std=c++14 bench_simd_string.cpp -o bench_simd_string
+//           (os kernels AVX2 são escolhidos em tempo de execução)
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "simd_string.h"
+
+//! Mede o tempo (ms) de fn: o menor de cinco, depois de um aquecimento
+template<typename F>
+double measure(F fn) {
+  fn();
+  double best = 1e300;
+  for (auto i = 0; i < 5; i++) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    best = std::min(best,
+                    std::chrono::duration<double, std::milli>(end - start)
+                        .count());
+  }
+  return best;
+}
+
+int main() {
+  const auto pairs = 1024u;
+  const auto rounds = 400u;
+  std::mt19937 random(42);
+  for (std::size_t length : {8u, 15u, 40u, 200u, 1000u}) {
+    // pares iguais até o último byte (o pior caso para a busca)
+    std::vector<std::string> a(pairs), b(pairs);
+    for (auto i = 0u; i < pairs; i++) {
+      for (auto j = 0u; j < length; j++) {
+        a[i].push_back(static_cast<char>('a' + random() % 26));
+      }
+      b[i] = a[i];
+      b[i][length - 1] = static_cast<char>(random() % 2 ? 'A' : a[i].back());
+    }
+    long long sink = 0;
+    auto simd_equal = measure([&] {
+      for (auto r = 0u; r < rounds; r++) {
+        for (auto i = 0u; i < pairs; i++) {
+          sink += structures::simd::equal(a[i].data(), b[i].data(), length);
+        }
+      }
+    });
+    auto memcmp_equal = measure([&] {
+      for (auto r = 0u; r < rounds; r++) {
+        for (auto i = 0u; i < pairs; i++) {
+          sink += std::memcmp(a[i].data(), b[i].data(), length) == 0;
+        }
+      }
+    });
+    auto simd_compare = measure([&] {
+      for (auto r = 0u; r < rounds; r++) {
+        for (auto i = 0u; i < pairs; i++) {
+          sink += structures::simd::compare(a[i].data(), length,
+                                            b[i].data(), length) < 0;
+        }
+      }
+    });
+    auto strcmp_compare = measure([&] {
+      for (auto r = 0u; r < rounds; r++) {
+        for (auto i = 0u; i < pairs; i++) {
+          sink += std::strcmp(a[i].c_str(), b[i].c_str()) < 0;
+        }
+      }
+    });
+    auto per = 1e6 / (pairs * rounds);
+    std::printf("%4zu bytes  equal %6.2f ns  memcmp %6.2f ns  |  compare "
+                "%6.2f ns  strcmp %6.2f ns  (%lld)\n", length,
+                simd_equal * per, memcmp_equal * per, simd_compare * per,
+                strcmp_compare * per, sink);
+  }
+  return 0;
+}
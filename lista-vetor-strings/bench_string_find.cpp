@@ -0,0 +1,98 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de busca em 1M URLs: índice hash, busca binária, varredura
+// das chaves e laço com strcmp.
+// Compilar: g++ -O2 -std=c++14 bench_string_find.cpp -o bench_string_find
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "string_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Escreve em data a URL de número i
+void url(char* data, std::size_t size, unsigned i) {
+  std::snprintf(data, size, "https://www.example.com.br/produtos/%u/item-%u",
+                i % 97, i);
+}
+
+//! Tempo médio (ms) de uma busca em list, de URLs presentes ou não
+double lookup(structures::ArrayListString& list, bool present,
+              unsigned queries, std::size_t& found) {
+  std::mt19937 random(42);
+  char data[80];
+  auto n = list.size();
+  return measure([&] {
+    for (auto q = 0u; q < queries; q++) {
+      url(data, sizeof(data), present ? random() % n : n + q);
+      found += list.find(data);
+    }
+  }) / queries;
+}
+
+int main() {
+  const std::size_t n = 1000000u;
+  structures::ArrayListString indexed(n);
+  structures::ArrayListString scanned(n, false);
+  char data[80];
+  auto load_indexed = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      url(data, sizeof(data), i);
+      indexed.push_back(data);
+    }
+  });
+  auto load_scanned = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      url(data, sizeof(data), i);
+      scanned.push_back(data);
+    }
+  });
+  // ordenada, sem índice: busca binária
+  structures::ArrayListString sorted(n, false);
+  auto load_sorted = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      sorted.push_back(scanned[i]);
+    }
+    sorted.sort();
+  });
+  std::printf("carga: com índice %8.2f ms  sem índice %8.2f ms  "
+              "ordenada %8.2f ms\n", load_indexed, load_scanned, load_sorted);
+  structures::ArrayListString inserted(100000u, false);
+  auto insert_sorted = measure([&] {
+    for (auto i = 0u; i < 100000u; i++) {
+      url(data, sizeof(data), i * 2654435761u % n);
+      inserted.insert_sorted(data);
+    }
+  });
+  std::printf("insert_sorted de 100000 URLs: %8.2f ms\n", insert_sorted);
+  for (auto present : {true, false}) {
+    std::size_t found = 0;
+    auto hash = lookup(indexed, present, 100000u, found);
+    auto binary = lookup(sorted, present, 100000u, found);
+    auto keys = lookup(scanned, present, 200u, found);
+    std::mt19937 random(42);
+    std::size_t steps = 0;
+    auto strcmps = measure([&] {
+      for (auto q = 0u; q < 200u; q++) {
+        url(data, sizeof(data), present ? random() % n : n + q);
+        auto i = 0u;
+        while (i < scanned.size() && std::strcmp(scanned[i], data) != 0) {
+          i++;
+        }
+        steps += i;
+      }
+    }) / 200u;
+    std::printf("%-9s índice %8.5f ms/busca  binária %8.5f ms/busca  "
+                "chaves %8.3f ms/busca  strcmp %8.3f ms/busca  (%zu, %zu)\n",
+                present ? "presente" : "ausente", hash, binary, keys, strcmps,
+                found, steps);
+  }
+  return 0;
+}
@@ -0,0 +1,81 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de carga, leitura e limpeza de muitas strings.
+// Compilar: g++ -O2 -std=c++14 bench_string_list.cpp -o bench_string_list
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "string_list.h"
+
+//! Quantidade de alocações feitas pelo programa
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  if (void* pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Carrega n strings no formato format, lê todas e limpa a lista
+void bench(const char* name, const char* format, std::size_t n) {
+  structures::ArrayListString list(n);
+  char data[32];
+  auto before = allocations;
+  auto load = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      std::snprintf(data, sizeof(data), format, i * 2654435761u % n);
+      list.push_back(data);
+    }
+  });
+  auto loaded = allocations - before;
+  std::size_t length = 0;
+  auto read = measure([&] {
+    for (auto i = 0u; i < list.size(); i++) {
+      length += std::strlen(list[i]);
+    }
+  });
+  auto clear = measure([&] { list.clear(); });
+  std::printf("%-7s n=%-8zu carga %8.2f ms (%zu alocações)  leitura %6.2f ms"
+              "  clear %6.2f ms  (%zu)\n", name, n, load, loaded, read, clear,
+              length);
+}
+
+int main() {
+  for (std::size_t n : {1000000u, 5000000u}) {
+    // até 15 chars: cabem na entrada
+    bench("curtas", "id_%u", n);
+    bench("longas", "cidade_de_numero_%u", n);
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de ordenação de strings: multikey quicksort x std::sort.
+// Compilar: g++ -O2 -std=c++14 bench_string_sort.cpp -o bench_string_sort
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "string_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Preenche a lista com n strings de prefixo comum e sufixo aleatório
+void fill(structures::ArrayListString& list, std::size_t n,
+          std::size_t prefix) {
+  std::mt19937 random(42);
+  char data[64];
+  list.clear();
+  for (auto i = 0u; i < n; i++) {
+    auto length = prefix + 4 + random() % 12;
+    for (auto j = 0u; j < length; j++) {
+      data[j] = j < prefix ? 'p' : static_cast<char>('a' + random() % 26);
+    }
+    data[length] = '\0';
+    list.push_back(data);
+  }
+}
+
+int main() {
+  const std::size_t n = 1000000u;
+  for (std::size_t prefix : {0u, 8u, 24u}) {
+    structures::ArrayListString list(n);
+    fill(list, n, prefix);
+    std::vector<const char*> pointers(n);
+    for (auto i = 0u; i < n; i++) {
+      pointers[i] = list[i];
+    }
+    auto comparison = measure([&] {
+      std::sort(pointers.begin(), pointers.end(),
+                [](const char* a, const char* b) {
+                  return std::strcmp(a, b) < 0;
+                });
+    });
+    auto multikey = measure([&] { list.sort(); });
+    std::printf("n=%zu prefixo %-2zu std::sort+strcmp %8.2f ms  "
+                "multikey %8.2f ms  (%.2fx)\n", n, prefix, comparison,
+                multikey, comparison / multikey);
+  }
+  return 0;
+}
@@ -0,0 +1,168 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_SIMD_STRING_H
+#define STRUCTURES_SIMD_STRING_H
+
+#include <algorithm>  // std::min
+#include <cstdint>
+#include <cstring>  // std::memcpy
+
+#include "../lista-vetor/simd_find.h"
+
+//! Comparação vetorizada de strings de tamanho conhecido.
+/*!
+  Usa os registradores de simd_find.h e a mesma escolha em tempo de
+  execução: 32 bytes por passo com AVX2, 16 com SSE2. Strings menores
+  que um registrador são comparadas 8 bytes por vez; fora do x86-64,
+  byte a byte.
+*/
+namespace structures {
+namespace simd {
+
+#if defined(STRUCTURES_SIMD_X86)
+//! Lê 8 bytes sem exigir alinhamento
+inline std::uint64_t word(const char* data) {
+  std::uint64_t value;
+  std::memcpy(&value, data, 8);
+  return value;
+}
+
+namespace sse2 {
+
+//! Máscara de bytes iguais entre a e b no bloco de um registrador
+inline std::uint32_t same(const char* a, const char* b) {
+  return mask(Lane<char>::equal(load(a), load(b)));
+}
+
+//! Máscara com todos os bytes de um registrador iguais
+constexpr std::uint32_t ALL = 0xffffu;
+
+//! mismatch para size >= 16
+inline std::size_t mismatch(const char* a, const char* b, std::size_t size) {
+  constexpr std::size_t step = sizeof(Register);
+  std::size_t i = 0;
+  // quatro registradores por iteração; ao achar, o laço seguinte localiza
+  for (; i + 4 * step <= size; i += 4 * step) {
+    if ((same(a + i, b + i) & same(a + i + step, b + i + step) &
+         same(a + i + 2 * step, b + i + 2 * step) &
+         same(a + i + 3 * step, b + i + 3 * step)) != ALL) {
+      break;
+    }
+  }
+  for (; i + step <= size; i += step) {
+    auto equal = same(a + i, b + i);
+    if (equal != ALL) {
+      return i + __builtin_ctz(~equal);
+    }
+  }
+  if (i == size) {
+    return size;
+  }
+  // último bloco sobreposto ao anterior, que já era igual
+  i = size - step;
+  auto equal = same(a + i, b + i);
+  return equal == ALL ? size : i + __builtin_ctz(~equal);
+}
+
+}  // namespace sse2
+
+namespace avx2 {
+
+//! Compila a função para AVX2, mesmo sem -mavx2
+#define STRUCTURES_AVX2 __attribute__((target("avx2")))
+
+STRUCTURES_AVX2 inline std::uint32_t same(const char* a, const char* b) {
+  return mask(Lane<char>::equal(load(a), load(b)));
+}
+
+constexpr std::uint32_t ALL = 0xffffffffu;
+
+//! Como sse2::mismatch, para size >= 32
+STRUCTURES_AVX2 inline std::size_t mismatch(const char* a, const char* b,
+                                            std::size_t size) {
+  constexpr std::size_t step = sizeof(Register);
+  std::size_t i = 0;
+  for (; i + 4 * step <= size; i += 4 * step) {
+    if ((same(a + i, b + i) & same(a + i + step, b + i + step) &
+         same(a + i + 2 * step, b + i + 2 * step) &
+         same(a + i + 3 * step, b + i + 3 * step)) != ALL) {
+      break;
+    }
+  }
+  for (; i + step <= size; i += step) {
+    auto equal = same(a + i, b + i);
+    if (equal != ALL) {
+      return i + __builtin_ctz(~equal);
+    }
+  }
+  if (i == size) {
+    return size;
+  }
+  i = size - step;
+  auto equal = same(a + i, b + i);
+  return equal == ALL ? size : i + __builtin_ctz(~equal);
+}
+
+}  // namespace avx2
+
+#undef STRUCTURES_AVX2
+#endif
+
+//! Posição do primeiro byte diferente entre a e b em [0, size), ou size
+inline std::size_t mismatch(const char* a, const char* b, std::size_t size) {
+  std::size_t i = 0;
+#if defined(STRUCTURES_SIMD_X86)
+  if (size >= sizeof(avx2::Register) && has_avx2()) {
+    return avx2::mismatch(a, b, size);
+  }
+  if (size >= sizeof(sse2::Register)) {
+    return sse2::mismatch(a, b, size);
+  }
+  // menor que um registrador: palavras de 8 bytes (x86 é little-endian)
+  for (; i + 8 <= size; i += 8) {
+    auto difference = word(a + i) ^ word(b + i);
+    if (difference != 0) {
+      return i + __builtin_ctzll(difference) / 8;
+    }
+  }
+  if (i < size && size >= 8) {
+    i = size - 8;
+    auto difference = word(a + i) ^ word(b + i);
+    return difference == 0 ? size : i + __builtin_ctzll(difference) / 8;
+  }
+#endif
+  for (; i < size; i++) {
+    if (a[i] != b[i]) {
+      return i;
+    }
+  }
+  return size;
+}
+
+//! Verifica se a[0, size) e b[0, size) são iguais
+inline bool equal(const char* a, const char* b, std::size_t size) {
+#if defined(STRUCTURES_SIMD_X86)
+  // sem desvio por bloco: acumula as diferenças e testa uma vez
+  if (size >= 8 && size <= 16) {
+    return ((word(a) ^ word(b)) |
+            (word(a + size - 8) ^ word(b + size - 8))) == 0;
+  }
+#endif
+  return mismatch(a, b, size) == size;
+}
+
+//! Compara como strcmp (bytes sem sinal), com os tamanhos conhecidos
+inline int compare(const char* a, std::size_t length_a,
+                   const char* b, std::size_t length_b) {
+  auto size = std::min(length_a, length_b);
+  auto i = mismatch(a, b, size);
+  if (i < size) {
+    return static_cast<unsigned char>(a[i]) -
+           static_cast<unsigned char>(b[i]);
+  }
+  return length_a < length_b ? -1 : length_a > length_b ? 1 : 0;
+}
+
+}  // namespace simd
+}  // namespace structures
+
+#endif
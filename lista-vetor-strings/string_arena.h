@@ -0,0 +1,162 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_STRING_ARENA_H
+#define STRUCTURES_STRING_ARENA_H
+
+#include <algorithm>  // std::max
+#include <cstdint>
+#include <cstring>  // std::memcpy, std::strlen
+#include <utility>  // std::swap
+
+namespace structures {
+
+//! Alocador em blocos para strings: aloca avançando um ponteiro
+/*!
+  As strings ficam contíguas em blocos grandes, que dobram de tamanho
+  até MAX_CHUNK. Não há liberação individual: clear() descarta tudo de
+  uma vez, mantendo o maior bloco para reuso.
+*/
+class StringArena {
+ public:
+  //! construtor: o primeiro bloco terá chunk_size bytes
+  explicit StringArena(std::size_t chunk_size = DEFAULT_CHUNK);
+  //! não copiável: as listas guardam ponteiros para os blocos
+  StringArena(const StringArena&) = delete;
+  //! não copiável
+  StringArena& operator=(const StringArena&) = delete;
+  //! destrutor
+  ~StringArena();
+  //! reserva size bytes
+  char* allocate(std::size_t size);
+  //! copia data (com o '\0') para a arena
+  char* copy(const char* data);
+  //! copia data, de tamanho length já conhecido, para a arena
+  char* copy(const char* data, std::size_t length);
+  //! descarta todas as strings
+  void clear();
+  //! troca os blocos com other
+  void swap(StringArena& other);
+  //! quantidade de blocos alocados
+  std::size_t chunks() const;
+  //! bytes ocupados por strings
+  std::size_t used() const;
+
+ private:
+  //! cabeçalho de um bloco; os dados vêm logo em seguida
+  struct Chunk {
+    //! bloco anterior
+    Chunk* next;
+    //! bytes de dados do bloco
+    std::size_t size;
+    //! início dos dados
+    char* data() {
+      return reinterpret_cast<char*>(this + 1);
+    }
+  };
+  //! aloca um bloco com pelo menos size bytes e passa a usá-lo
+  void grow(std::size_t size);
+  //! bloco atual (início da lista de blocos)
+  Chunk* head_{nullptr};
+  //! próximo byte livre do bloco atual
+  char* next_{nullptr};
+  //! fim do bloco atual
+  char* end_{nullptr};
+  //! tamanho do próximo bloco
+  std::size_t chunk_size_;
+  //! quantidade de blocos
+  std::size_t chunks_{0};
+  //! bytes ocupados nos blocos anteriores ao atual
+  std::size_t used_{0};
+  //! tamanho default do primeiro bloco
+  static const std::size_t DEFAULT_CHUNK = 4096u;
+  //! tamanho máximo de um bloco (exceto strings maiores que isso)
+  static const std::size_t MAX_CHUNK = 1u << 22;
+};
+
+}  // namespace structures
+
+inline structures::StringArena::StringArena(std::size_t chunk_size):
+  chunk_size_{std::max<std::size_t>(chunk_size, 64u)}
+{}
+
+inline structures::StringArena::~StringArena() {
+  while (head_ != nullptr) {
+    auto next = head_->next;
+    delete[] reinterpret_cast<char*>(head_);
+    head_ = next;
+  }
+}
+
+inline char* structures::StringArena::allocate(std::size_t size) {
+  if (static_cast<std::size_t>(end_ - next_) < size) {
+    grow(size);
+  }
+  auto data = next_;
+  next_ += size;
+  return data;
+}
+
+inline char* structures::StringArena::copy(const char* data) {
+  return copy(data, std::strlen(data));
+}
+
+inline char* structures::StringArena::copy(const char* data,
+                                           std::size_t length) {
+  auto copy = allocate(length + 1);
+  std::memcpy(copy, data, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+inline void structures::StringArena::clear() {
+  if (head_ == nullptr) {
+    return;
+  }
+  // mantém só o bloco atual, o maior deles
+  auto chunk = head_->next;
+  while (chunk != nullptr) {
+    auto next = chunk->next;
+    delete[] reinterpret_cast<char*>(chunk);
+    chunk = next;
+  }
+  head_->next = nullptr;
+  chunks_ = 1;
+  used_ = 0;
+  next_ = head_->data();
+  end_ = next_ + head_->size;
+}
+
+inline void structures::StringArena::swap(StringArena& other) {
+  std::swap(head_, other.head_);
+  std::swap(next_, other.next_);
+  std::swap(end_, other.end_);
+  std::swap(chunk_size_, other.chunk_size_);
+  std::swap(chunks_, other.chunks_);
+  std::swap(used_, other.used_);
+}
+
+inline std::size_t structures::StringArena::chunks() const {
+  return chunks_;
+}
+
+inline std::size_t structures::StringArena::used() const {
+  return head_ == nullptr ? 0u : used_ + (next_ - head_->data());
+}
+
+inline void structures::StringArena::grow(std::size_t size) {
+  auto capacity = std::max(size, chunk_size_);
+  auto chunk = reinterpret_cast<Chunk*>(new char[sizeof(Chunk) + capacity]);
+  chunk->next = head_;
+  chunk->size = capacity;
+  if (head_ != nullptr) {
+    used_ += next_ - head_->data();
+  }
+  head_ = chunk;
+  next_ = chunk->data();
+  end_ = next_ + capacity;
+  chunks_ += 1;
+  if (chunk_size_ < MAX_CHUNK) {
+    chunk_size_ *= 2;
+  }
+}
+
+#endif
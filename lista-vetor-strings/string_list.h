@@ -2,9 +2,17 @@
 #ifndef STRUCTURES_STRING_LIST_H
 #define STRUCTURES_STRING_LIST_H
 
+#include <algorithm>  // std::min
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
 #include <stdexcept>  // C++ exceptions
 #include <cstring>
+#include <memory>  // std::unique_ptr
+#include <utility>  // std::pair, std::swap
+
+#include "../lista-vetor/simd_find.h"
+#include "simd_string.h"
+#include "string_arena.h"
 
 namespace structures {
 
@@ -72,15 +80,49 @@ class ArrayList {
   static const auto DEFAULT_MAX = 10u;
 };
 
+//! Entrada de ArrayListString: a string curta ou um ponteiro para ela
+union StringEntry {
+  //! string de até 15 chars, com o '\0'
+  char chars[16];
+  //! string maior, guardada na arena
+  char *pointer;
+};
+
 //! ArrayListString é uma especializacao da classe ArrayList
-class ArrayListString : public ArrayList<char *> {
+/*!
+  Strings de até 15 chars ficam dentro do próprio vetor contents; as
+  maiores são copiadas para uma StringArena, contíguas, e liberadas
+  todas juntas em clear() ou na destruição da lista (ou compactadas
+  quando a arena acumula mais strings retiradas que vivas). Por isso o
+  ponteiro de operator[]/at só vale até a próxima alteração da lista.
+  Como antes da arena, pop* devolve uma cópia alocada com new[]: quem
+  a recebe é dono dela e deve liberá-la com delete[].
+
+  Para cada string a lista guarda também uma chave com o tamanho e um
+  hash, em um vetor paralelo a contents: find compara as chaves (de
+  forma vetorizada) e só olha os bytes das strings com chave igual.
+
+  Com o índice ligado (padrão), uma tabela hash de endereçamento aberto
+  guarda a posição de cada string: find e contains passam a ser O(1)
+  esperado, mas insert e pop fora do final pagam O(max_size) para
+  corrigir as posições. Listas com muitas escritas podem desligá-lo.
+
+  A lista sabe se está ordenada por strcmp (vazia, só insert_sorted,
+  inserções que respeitam os vizinhos ou depois de sort()). Ordenada,
+  insert_sorted, find, contains e remove usam busca binária (quando não
+  há índice) e starts_with devolve a faixa de strings com um prefixo.
+*/
+class ArrayListString : public ArrayList<StringEntry> {
  public:
   //! Construtor
-  ArrayListString() : ArrayList() {}
-  //! Construtor explicito
-  explicit ArrayListString(std::size_t max_size) : ArrayList(max_size) {}
-  //! Destrutor
-  ~ArrayListString();
+  ArrayListString() : ArrayList(), keys_(new std::uint64_t[max_size()]) {
+    set_indexed(true);
+  }
+  //! Construtor explicito, com ou sem índice hash
+  explicit ArrayListString(std::size_t max_size, bool indexed = true) :
+    ArrayList(max_size), keys_(new std::uint64_t[max_size]) {
+    set_indexed(indexed);
+  }
   //! Limpa lista
   void clear();
   //! Adiciona ao final
@@ -103,6 +145,82 @@ class ArrayListString : public ArrayList<char *> {
   bool contains(const char *data);
   //! Retorna índice do dado
   std::size_t find(const char *data);
+  //! Ordena (quicksort multichave, mesma ordem de strcmp)
+  void sort();
+  //! Verifica se a lista está ordenada por strcmp
+  bool sorted() const;
+  //! Faixa [início, fim) das strings que começam com prefix
+  /*!
+    Só para listas ordenadas; lança std::logic_error nas demais.
+  */
+  std::pair<std::size_t, std::size_t> starts_with(const char *prefix) const;
+  //! Liga (reconstruindo) ou desliga o índice hash
+  void set_indexed(bool indexed);
+  //! Verifica se o índice hash está ligado
+  bool indexed() const;
+  /*!
+    Retorna elemento da posição com verificação. Só leitura: a string
+    alterada deixaria a chave, o índice e sorted() desatualizados
+  */
+  const char *at(std::size_t index);
+  //! Retorna elemento da posição (só leitura, como at)
+  const char *operator[](std::size_t index);
+  //! Retorna elemento da posição com verificação
+  const char *at(std::size_t index) const;
+  //! Retorna elemento da posição
+  const char *operator[](std::size_t index) const;
+
+ private:
+  //! Ordena entries[0, size), que já coincidem nos depth primeiros chars
+  /*!
+    keys é permutado junto com entries.
+  */
+  static void multikey_sort(StringEntry *entries, std::uint64_t *keys,
+                            std::size_t size, std::size_t depth);
+  //! Chave de igualdade: tamanho nos 32 bits altos, hash FNV-1a nos baixos
+  static std::uint64_t key(const char *data, std::size_t length);
+  //! String da entrada, cuja chave é key
+  static char *text(StringEntry &entry, std::uint64_t key);
+  //! String da posição
+  char *text(std::size_t index) const;
+  //! Índice da string data, de tamanho length, ou size()
+  std::size_t find(const char *data, std::size_t length) const;
+  //! Primeira posição com string >= data (lista ordenada)
+  std::size_t lower_bound(const char *data, std::size_t length) const;
+  //! Tamanho da string da posição
+  std::size_t text_length(std::size_t index) const;
+  //! Verifica se a string da posição é data, de tamanho length
+  bool matches(std::size_t index, const char *data, std::size_t length) const;
+  //! Copia as strings vivas para uma arena nova se a atual é quase lixo
+  void compact();
+  //! Memória das strings
+  StringArena arena_;
+  //! Bytes da arena ocupados por strings ainda na lista
+  std::size_t arena_live_{0};
+  //! Abaixo disso a arena não é compactada
+  static const std::size_t COMPACT_MIN = 1u << 16;
+  //! Primeira posição da tabela a sondar para key
+  std::size_t slot(std::uint64_t key) const;
+  //! Coloca a posição position na tabela
+  void index_insert(std::size_t position);
+  //! Tira a posição position da tabela
+  void index_erase(std::size_t position);
+  //! Soma delta às posições a partir de from
+  void index_shift(std::size_t from, std::ptrdiff_t delta);
+  //! Refaz a tabela com as posições atuais
+  void index_rebuild();
+  //! Tamanho máximo das strings guardadas dentro de contents
+  static const std::size_t INLINE_MAX = sizeof(StringEntry) - 1;
+  //! Chaves das strings, na mesma ordem de contents
+  std::unique_ptr<std::uint64_t[]> keys_;
+  //! Tabela hash de posições (sondagem linear), ou nullptr sem índice
+  std::unique_ptr<std::size_t[]> index_;
+  //! Quantidade de posições da tabela menos um (potência de dois - 1)
+  std::size_t index_mask_{0};
+  //! Lista ordenada por strcmp
+  bool sorted_{true};
+  //! Posição vazia da tabela
+  static const std::size_t EMPTY = ~std::size_t(0);
 };
 
 }  // namespace structures
@@ -115,9 +233,9 @@ structures::ArrayList<T>::ArrayList(std::size_t max_size) {
 }
 
 template<typename T>
-structures::ArrayList<T>::ArrayList() {
-  ArrayList(std::size_t(DEFAULT_MAX));
-}
+structures::ArrayList<T>::ArrayList():
+  ArrayList(std::size_t(DEFAULT_MAX))
+{}
 
 template<typename T>
 structures::ArrayList<T>::~ArrayList() {
@@ -293,144 +411,428 @@ bool structures::ArrayList<T>::successor(const T& data1, const T& data2) {
   return data1 > data2;
 }
 
-structures::ArrayListString::~ArrayListString() {
-  clear();
-}
-
-void structures::ArrayListString::clear() {
-  for (auto i = 0u; i < size(); i++) {
-    delete[] contents[i];
-  }
+inline void structures::ArrayListString::clear() {
+  arena_.clear();
+  arena_live_ = 0;
   size_ = 0;
+  sorted_ = true;
+  index_rebuild();
 }
 
-void structures::ArrayListString::push_back(const char* data) {
-  if (full()) {
-    throw std::out_of_range("Lista cheia");
-  }
-  char *datanew = new char[strlen(data)+1];
-  if (datanew == nullptr) {
-    throw std::out_of_range("Lista cheia");
-  }
-  snprintf(datanew, strlen(data)+1, "%s", data);
-  contents[size_] = datanew;
-  size_ += 1;
+inline void structures::ArrayListString::push_back(const char* data) {
+  insert(data, size());
 }
 
-void structures::ArrayListString::push_front(const char *data) {
-  if (full()) {
-    throw std::out_of_range("Lista cheia");
-  }
-  char *datanew = new char[strlen(data)+1];
-  if (datanew == nullptr) {
-    throw std::out_of_range("Lista cheia");
-  }
-  snprintf(datanew, strlen(data)+1, "%s", data);
-  size_ += 1;
-  for (auto i = size() - 1; i >= 1; i--) {
-    contents[i] = contents[i - 1];
-  }
-  contents[0] = datanew;
+inline void structures::ArrayListString::push_front(const char *data) {
+  insert(data, 0u);
 }
 
-void structures::ArrayListString::insert(const char *data, std::size_t index) {
+inline void structures::ArrayListString::insert(const char *data,
+                                                std::size_t index) {
   if (full()) {
     throw std::out_of_range("Lista cheia");
   }
   if (index > size()) {
     throw std::out_of_range("Index Out of Range");
   }
-  char *datanew = new char[strlen(data)+1];
-  if (datanew == nullptr) {
-    throw std::out_of_range("Lista cheia");
-  }
-  snprintf(datanew, strlen(data)+1, "%s", data);
-  for (auto i = size(); i > index; i--) {
-    contents[i] = contents[i - 1];
-  }
-  contents[index] = datanew;
+  auto length = strlen(data);
+  // a entrada é montada antes de deslocar: data pode estar em contents
+  StringEntry entry;
+  if (length <= INLINE_MAX) {
+    std::memcpy(entry.chars, data, length + 1);
+  } else {
+    entry.pointer = arena_.copy(data, length);
+    arena_live_ += length + 1;
+  }
+  sorted_ = sorted_ &&
+            (index == 0 || simd::compare(text(index - 1),
+                                         text_length(index - 1),
+                                         data, length) <= 0) &&
+            (index == size() || simd::compare(data, length, text(index),
+                                              text_length(index)) <= 0);
+  auto count = size() - index;
+  if (count > 0) {
+    index_shift(index, 1);
+  }
+  auto datakey = key(data, length);
+  std::memmove(contents + index + 1, contents + index,
+               count * sizeof(StringEntry));
+  std::memmove(keys_.get() + index + 1, keys_.get() + index,
+               count * sizeof(std::uint64_t));
+  contents[index] = entry;
+  keys_[index] = datakey;
   size_ += 1;
+  index_insert(index);
 }
 
-void structures::ArrayListString::insert_sorted(const char *data) {
+inline void structures::ArrayListString::insert_sorted(const char *data) {
   if (full()) {
     throw std::out_of_range("Lista cheia");
   }
-  char *datanew = new char[strlen(data)+1];
-  if (datanew == nullptr) {
-    throw std::out_of_range("Lista cheia");
-  }
-  snprintf(datanew, strlen(data)+1, "%s", data);
+  auto length = strlen(data);
   std::size_t pos = 0;
-  while (pos < size_ && strcmp(datanew, contents[pos]) > 0) {
-    pos += 1;
+  if (sorted_) {
+    pos = lower_bound(data, length);
+  } else {
+    while (pos < size_ &&
+           simd::compare(data, length, text(pos), text_length(pos)) > 0) {
+      pos += 1;
+    }
   }
   insert(data, pos);
 }
 
-char* structures::ArrayListString::pop(std::size_t index) {
+inline char* structures::ArrayListString::pop(std::size_t index) {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   if (index >= size()) {
     throw std::out_of_range("Índice fora do limite");
   }
-  auto data = contents[index];
-  for (auto i = index; i < size() - 1; i++) {
-    contents[i] = contents[i + 1];
-  }
+  // quem recebe é dono da cópia, como antes da arena
+  auto length = text_length(index);
+  auto data = new char[length + 1];
+  std::memcpy(data, text(index), length + 1);
+  if (length > INLINE_MAX) {
+    arena_live_ -= length + 1;
+  }
+  auto count = size() - index - 1;
+  index_erase(index);
+  std::memmove(contents + index, contents + index + 1,
+               count * sizeof(StringEntry));
+  std::memmove(keys_.get() + index, keys_.get() + index + 1,
+               count * sizeof(std::uint64_t));
   size_ -= 1;
+  if (count > 0) {
+    index_shift(index + 1, -1);
+  }
+  compact();
   return data;
 }
 
-char* structures::ArrayListString::pop_back() {
+inline char* structures::ArrayListString::pop_back() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
-  size_ -= 1;
-  return contents[size()];
+  return pop(size() - 1);
 }
 
-char* structures::ArrayListString::pop_front() {
+inline char* structures::ArrayListString::pop_front() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
-  auto data = contents[0];
-  for (auto i = 1u; i < size(); i++) {
-    contents[i - 1] = contents[i];
-  }
-  size_ -= 1;
-  return data;
+  return pop(0u);
 }
 
-void structures::ArrayListString::remove(const char *data) {
+inline void structures::ArrayListString::remove(const char *data) {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   auto index = find(data);
-  pop(index);
+  delete[] pop(index);
 }
 
-bool structures::ArrayListString::contains(const char *data) {
-  auto contain = false;
-  for (auto i = 0u; i < size(); i++) {
-    if (strcmp(contents[i], data) == 0) {
-      contain = true;
+inline bool structures::ArrayListString::contains(const char *data) {
+  return find(data) != size();
+}
+
+inline std::size_t structures::ArrayListString::find(const char *data) {
+  return find(data, strlen(data));
+}
+
+inline std::size_t structures::ArrayListString::find(
+    const char *data, std::size_t length) const {
+  auto wanted = key(data, length);
+  if (index_) {
+    // strings repetidas: a menor posição entre as iguais
+    auto index = size();
+    for (auto i = slot(wanted); index_[i] != EMPTY;
+         i = (i + 1) & index_mask_) {
+      auto position = index_[i];
+      if (position < index && keys_[position] == wanted &&
+          matches(position, data, length)) {
+        index = position;
+      }
+    }
+    return index;
+  }
+  if (sorted_) {
+    auto index = lower_bound(data, length);
+    if (index < size() && keys_[index] == wanted &&
+        matches(index, data, length)) {
+      return index;
+    }
+    return size();
+  }
+  std::size_t index = 0;
+  while (index < size()) {
+    // só strings de mesmo tamanho e hash chegam à comparação de bytes
+    index += simd::find(keys_.get() + index, size() - index, wanted);
+    if (index == size() || matches(index, data, length)) {
       break;
     }
+    index += 1;
   }
-  return contain;
+  return index;
 }
 
-std::size_t structures::ArrayListString::find(const char *data) {
-  auto index = size();
+inline void structures::ArrayListString::sort() {
+  multikey_sort(contents, keys_.get(), size(), 0);
+  sorted_ = true;
+  index_rebuild();
+}
+
+inline bool structures::ArrayListString::sorted() const {
+  return sorted_;
+}
+
+inline std::pair<std::size_t, std::size_t>
+structures::ArrayListString::starts_with(const char *prefix) const {
+  if (!sorted_) {
+    throw std::logic_error("Lista não ordenada");
+  }
+  auto length = strlen(prefix);
+  auto begin = lower_bound(prefix, length);
+  // as strings com o prefixo são as primeiras a partir de begin
+  auto end = size();
+  auto pos = begin;
+  while (pos < end) {
+    auto middle = pos + (end - pos) / 2;
+    if (text_length(middle) >= length &&
+        simd::equal(text(middle), prefix, length)) {
+      pos = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return {begin, pos};
+}
+
+inline std::size_t structures::ArrayListString::lower_bound(
+    const char *data, std::size_t length) const {
+  std::size_t pos = 0;
+  std::size_t end = size();
+  while (pos < end) {
+    auto middle = pos + (end - pos) / 2;
+    if (simd::compare(text(middle), text_length(middle), data, length) < 0) {
+      pos = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return pos;
+}
+
+inline std::size_t structures::ArrayListString::text_length(
+    std::size_t index) const {
+  auto length = keys_[index] >> 32;
+  // tamanho saturado na chave: só strlen sabe o real
+  return length == 0xffffffffu ? strlen(text(index)) : length;
+}
+
+inline void structures::ArrayListString::compact() {
+  // só quando o lixo passa das strings vivas: o custo da cópia se paga
+  // com os bytes retirados desde a última compactação
+  auto used = arena_.used();
+  if (used < COMPACT_MIN || used < 2 * arena_live_) {
+    return;
+  }
+  StringArena fresh;
   for (auto i = 0u; i < size(); i++) {
-    if (strcmp(contents[i], data) == 0) {
-      index = i;
+    auto length = text_length(i);
+    if (length > INLINE_MAX) {
+      contents[i].pointer = fresh.copy(contents[i].pointer, length);
+    }
+  }
+  arena_.swap(fresh);
+}
+
+inline bool structures::ArrayListString::matches(
+    std::size_t index, const char *data, std::size_t length) const {
+  return text_length(index) == length &&
+         simd::equal(text(index), data, length);
+}
+
+inline void structures::ArrayListString::set_indexed(bool indexed) {
+  if (!indexed) {
+    index_.reset();
+    index_mask_ = 0;
+    return;
+  }
+  if (!index_) {
+    // pelo menos o dobro de max_size: fator de carga <= 1/2
+    std::size_t capacity = 16u;
+    while (capacity < 2 * max_size()) {
+      capacity *= 2;
+    }
+    index_.reset(new std::size_t[capacity]);
+    index_mask_ = capacity - 1;
+  }
+  index_rebuild();
+}
+
+inline bool structures::ArrayListString::indexed() const {
+  return index_ != nullptr;
+}
+
+inline std::size_t structures::ArrayListString::slot(std::uint64_t key) const {
+  // hash de Fibonacci: espalha os bits da chave pela tabela
+  return (key * 0x9e3779b97f4a7c15ull) >> 32 & index_mask_;
+}
+
+inline void structures::ArrayListString::index_insert(std::size_t position) {
+  if (!index_) {
+    return;
+  }
+  auto i = slot(keys_[position]);
+  while (index_[i] != EMPTY) {
+    i = (i + 1) & index_mask_;
+  }
+  index_[i] = position;
+}
+
+inline void structures::ArrayListString::index_erase(std::size_t position) {
+  if (!index_) {
+    return;
+  }
+  auto i = slot(keys_[position]);
+  while (index_[i] != position) {
+    i = (i + 1) & index_mask_;
+  }
+  // remoção com deslocamento para trás: sem marcas de removido
+  auto j = i;
+  while (true) {
+    j = (j + 1) & index_mask_;
+    if (index_[j] == EMPTY) {
       break;
     }
+    auto home = slot(keys_[index_[j]]);
+    // index_[j] pode ir para i se i está entre home e j (circularmente)
+    if (((j - home) & index_mask_) >= ((j - i) & index_mask_)) {
+      index_[i] = index_[j];
+      i = j;
+    }
+  }
+  index_[i] = EMPTY;
+}
+
+inline void structures::ArrayListString::index_shift(
+    std::size_t from, std::ptrdiff_t delta) {
+  if (!index_) {
+    return;
+  }
+  for (std::size_t i = 0; i <= index_mask_; i++) {
+    if (index_[i] != EMPTY && index_[i] >= from) {
+      index_[i] += delta;
+    }
+  }
+}
+
+inline void structures::ArrayListString::index_rebuild() {
+  if (!index_) {
+    return;
+  }
+  for (std::size_t i = 0; i <= index_mask_; i++) {
+    index_[i] = EMPTY;
+  }
+  for (auto position = 0u; position < size(); position++) {
+    index_insert(position);
+  }
+}
+
+inline std::uint64_t structures::ArrayListString::key(
+    const char *data, std::size_t length) {
+  std::uint32_t hash = 2166136261u;
+  for (auto i = 0u; i < length; i++) {
+    hash = (hash ^ static_cast<unsigned char>(data[i])) * 16777619u;
+  }
+  // tamanhos que não cabem em 32 bits ficam saturados
+  auto size = std::min<std::uint64_t>(length, 0xffffffffu);
+  return (size << 32) | hash;
+}
+
+inline char *structures::ArrayListString::text(
+    StringEntry &entry, std::uint64_t key) {
+  return (key >> 32) <= INLINE_MAX ? entry.chars : entry.pointer;
+}
+
+inline char *structures::ArrayListString::text(std::size_t index) const {
+  return text(contents[index], keys_[index]);
+}
+
+inline const char *structures::ArrayListString::at(std::size_t index) {
+  if (index >= size()) {
+    throw std::out_of_range("Index Out Of Range");
+  }
+  return text(index);
+}
+
+inline const char *structures::ArrayListString::operator[](std::size_t index) {
+  return text(index);
+}
+
+inline const char *structures::ArrayListString::at(std::size_t index) const {
+  if (index >= size()) {
+    throw std::out_of_range("Index Out Of Range");
+  }
+  return text(index);
+}
+
+inline const char *structures::ArrayListString::operator[](
+    std::size_t index) const {
+  return text(index);
+}
+
+inline void structures::ArrayListString::multikey_sort(
+    StringEntry *entries, std::uint64_t *keys, std::size_t size,
+    std::size_t depth) {
+  while (size > 1) {
+    if (size < 16) {
+      // inserção, comparando só a partir de depth
+      for (auto i = 1u; i < size; i++) {
+        auto data = entries[i];
+        auto data_key = keys[i];
+        auto data_text = text(data, data_key) + depth;
+        auto j = i;
+        while (j > 0 &&
+               strcmp(text(entries[j - 1], keys[j - 1]) + depth,
+                      data_text) > 0) {
+          entries[j] = entries[j - 1];
+          keys[j] = keys[j - 1];
+          j--;
+        }
+        entries[j] = data;
+        keys[j] = data_key;
+      }
+      return;
+    }
+    // partição em três pelo caractere depth (sem sinal, como strcmp)
+    auto middle = size / 2;
+    auto pivot = static_cast<unsigned char>(
+        text(entries[middle], keys[middle])[depth]);
+    std::size_t less = 0;
+    std::size_t greater = size;
+    std::size_t i = 0;
+    while (i < greater) {
+      auto c = static_cast<unsigned char>(text(entries[i], keys[i])[depth]);
+      if (c < pivot) {
+        std::swap(keys[less], keys[i]);
+        std::swap(entries[less++], entries[i++]);
+      } else if (c > pivot) {
+        std::swap(keys[i], keys[--greater]);
+        std::swap(entries[i], entries[greater]);
+      } else {
+        i++;
+      }
+    }
+    multikey_sort(entries, keys, less, depth);
+    if (pivot != 0) {
+      multikey_sort(entries + less, keys + less, greater - less, depth + 1);
+    }
+    entries += greater;
+    keys += greater;
+    size -= greater;
   }
-  return index;
 }
 
 #endif
@@ -1,4 +1,9 @@
 //  "Copyright [2018] <Alexandre Goncalves Silva>"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
 #include "gtest/gtest.h"
 #include "./string_list.h"
 
@@ -8,6 +13,13 @@ int main(int argc, char* argv[]) {
     return RUN_ALL_TESTS();
 }
 
+//! Conteúdo de uma string devolvida por pop*, liberando-a
+std::string popped(char *data) {
+    std::string text{data};
+    delete[] data;
+    return text;
+}
+
 //! Comment
 class ArrayListStringTest: public ::testing::Test {
  protected:
@@ -224,7 +236,7 @@ TEST_F(ArrayListStringTest, PopBack) {
         list.push_back(city[i]);
     }
     for (auto i = 9; i >= 0; --i) {
-        ASSERT_STREQ(city[i], list.pop_back());
+        ASSERT_EQ(city[i], popped(list.pop_back()));
     }
     ASSERT_TRUE(list.empty());
     ASSERT_EQ(0u, list.size());
@@ -242,7 +254,7 @@ TEST_F(ArrayListStringTest, PopFront) {
         list.push_front(city[i]);
     }
     for (auto i = 0; i < 10; ++i) {
-        ASSERT_STREQ(city[i], list.pop_front());
+        ASSERT_EQ(city[i], popped(list.pop_front()));
     }
     ASSERT_TRUE(list.empty());
     ASSERT_EQ(0u, list.size());
@@ -255,8 +267,8 @@ TEST_F(ArrayListStringTest, PopAt) {
     for (auto i = 0; i < 10; ++i) {
         list.push_back(city[i]);
     }
-    ASSERT_STREQ(city[5], list.pop(5));
-    ASSERT_STREQ(city[6], list.pop(5));
+    ASSERT_EQ(city[5], popped(list.pop(5)));
+    ASSERT_EQ(city[6], popped(list.pop(5)));
     ASSERT_EQ(8u, list.size());
     ASSERT_THROW(list.pop(8), std::out_of_range);
 }
@@ -271,4 +283,304 @@ TEST_F(ArrayListStringTest, RemoveElement) {
     list.remove(city[4]);
     ASSERT_EQ(9u, list.size());
     ASSERT_FALSE(list.contains(city[4]));
-}
\ No newline at end of file
+}
+
+TEST_F(ArrayListStringTest, Sort) {
+    const char *city[10] = {"Sao_Jose", "Lages", "Blumenau", \
+    "Joinville", "Itajai", "Chapeco", "Florianopolis", \
+    "Palhoca", "Jaragua_do_Sul", "Criciuma"};
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(city[i]);
+    }
+    list.sort();
+    ASSERT_STREQ("Blumenau", list[0]);
+    ASSERT_STREQ("Chapeco", list[1]);
+    ASSERT_STREQ("Sao_Jose", list[9]);
+}
+
+TEST(ArrayListStringSortTest, SharedPrefixesAndBytes) {
+    structures::ArrayListString list{2000u};
+    char data[8] = {};
+    for (auto i = 0; i < 2000; ++i) {
+        auto length = 1 + std::rand() % 6;
+        for (auto j = 0; j < length; ++j) {
+            // poucos caracteres distintos, incluindo bytes acima de 127
+            const char alphabet[] = {'a', 'b', 'c', '\xe9'};
+            data[j] = alphabet[std::rand() % 4];
+        }
+        data[length] = '\0';
+        list.push_back(data);
+    }
+    list.sort();
+    ASSERT_EQ(2000u, list.size());
+    for (auto i = 1u; i < list.size(); ++i) {
+        ASSERT_LE(strcmp(list[i - 1], list[i]), 0);
+    }
+}
+
+TEST_F(ArrayListStringTest, AccessIsReadOnly) {
+    // escrever pela lista deixaria chaves e índice desatualizados
+    static_assert(std::is_same<decltype(list[0]), const char *>::value,
+                  "operator[] só leitura");
+    static_assert(std::is_same<decltype(list.at(0)), const char *>::value,
+                  "at só leitura");
+    list.push_back("Joinville");
+    ASSERT_STREQ("Joinville", list.at(0));
+    ASSERT_EQ(0u, list.find("Joinville"));
+}
+
+TEST_F(ArrayListStringTest, PoppedStringsAreOwned) {
+    list.push_back("Blumenau");
+    list.push_back("Chapeco");
+    std::unique_ptr<char[]> first{list.pop_front()};
+    list.push_back("Criciuma");
+    list.remove("Chapeco");
+    list.clear();
+    // a cópia não depende da lista
+    ASSERT_STREQ("Blumenau", first.get());
+    list.push_back("Criciuma");
+    ASSERT_STREQ("Criciuma", list[0]);
+    list.clear();
+    list.push_back("Lages");
+    ASSERT_EQ(1u, list.size());
+    ASSERT_STREQ("Lages", list[0]);
+}
+
+TEST_F(ArrayListStringTest, PushOwnElement) {
+    list.push_back("Palhoca");
+    for (auto i = 0; i < 9; ++i) {
+        list.push_back(list[0]);
+    }
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_STREQ("Palhoca", list[i]);
+    }
+}
+
+TEST(StringArenaTest, FewChunksForManyStrings) {
+    structures::StringArena arena;
+    char data[16];
+    std::size_t used = 0;
+    for (auto i = 0; i < 100000; ++i) {
+        snprintf(data, sizeof(data), "%d", i);
+        used += strlen(data) + 1;
+        ASSERT_STREQ(data, arena.copy(data));
+    }
+    ASSERT_EQ(used, arena.used());
+    ASSERT_LE(arena.chunks(), 10u);
+    arena.clear();
+    ASSERT_EQ(1u, arena.chunks());
+    ASSERT_EQ(0u, arena.used());
+}
+
+TEST(StringArenaTest, LargeString) {
+    structures::StringArena arena{64u};
+    std::string large(100000u, 'x');
+    auto small = arena.copy("abc");
+    auto copy = arena.copy(large.c_str());
+    ASSERT_EQ(large, copy);
+    ASSERT_STREQ("abc", small);
+    ASSERT_EQ(2u, arena.chunks());
+}
+
+TEST_F(ArrayListStringTest, FindSameLengthAndPrefixes) {
+    const char *data[6] = {"abc", "abd", "ab", "abcd", "", "bca"};
+    for (auto i = 0; i < 6; ++i) {
+        list.push_back(data[i]);
+    }
+    for (auto i = 0u; i < 6u; ++i) {
+        ASSERT_EQ(i, list.find(data[i]));
+    }
+    ASSERT_EQ(list.size(), list.find("abe"));
+    ASSERT_EQ(list.size(), list.find("a"));
+    list.remove("abd");
+    ASSERT_EQ(2u, list.find("abcd"));
+    list.sort();
+    ASSERT_EQ(0u, list.find(""));
+    ASSERT_EQ(3u, list.find("abcd"));
+    ASSERT_TRUE(list.contains("bca"));
+    ASSERT_FALSE(list.contains("abd"));
+}
+
+TEST_F(ArrayListStringTest, DefaultConstructor) {
+    structures::ArrayListString other;
+    ASSERT_EQ(10u, other.max_size());
+    other.push_front("Lages");
+    other.push_front("Blumenau");
+    ASSERT_EQ(1u, other.find("Lages"));
+}
+
+TEST(ArrayListStringIndexTest, MatchesReference) {
+    for (auto indexed : {true, false}) {
+        structures::ArrayListString list{300u, indexed};
+        std::vector<std::string> reference;
+        ASSERT_EQ(indexed, list.indexed());
+        for (auto step = 0; step < 5000; ++step) {
+            // poucos valores distintos: muitas repetições
+            auto data = "cidade_" + std::to_string(std::rand() % 50);
+            auto operation = std::rand() % 6;
+            if (operation < 3 && !list.full()) {
+                auto index = std::rand() % (reference.size() + 1);
+                list.insert(data.c_str(), index);
+                reference.insert(reference.begin() + index, data);
+            } else if (operation == 3 && !list.empty()) {
+                auto index = std::rand() % reference.size();
+                ASSERT_EQ(reference[index], popped(list.pop(index)));
+                reference.erase(reference.begin() + index);
+            } else if (operation == 4 && list.contains(data.c_str())) {
+                list.remove(data.c_str());
+                reference.erase(std::find(reference.begin(), reference.end(),
+                                          data));
+            } else if (operation == 5 && step % 500 == 0) {
+                list.set_indexed(!list.indexed());
+            }
+            auto expected = std::find(reference.begin(), reference.end(),
+                                      data) - reference.begin();
+            ASSERT_EQ(static_cast<std::size_t>(expected),
+                      list.find(data.c_str()));
+            ASSERT_EQ(reference.size(), list.size());
+        }
+        list.sort();
+        std::sort(reference.begin(), reference.end());
+        for (auto i = 0u; i < reference.size(); ++i) {
+            ASSERT_STREQ(reference[i].c_str(), list[i]);
+            auto first = std::lower_bound(reference.begin(), reference.end(),
+                                          reference[i]) - reference.begin();
+            ASSERT_EQ(static_cast<std::size_t>(first), list.find(list[i]));
+        }
+        list.clear();
+        ASSERT_FALSE(list.contains("cidade_1"));
+    }
+}
+
+TEST(ArrayListStringSortedTest, BinarySearchAndPrefixes) {
+    structures::ArrayListString list{2000u, false};
+    std::vector<std::string> reference;
+    for (auto i = 0; i < 2000; ++i) {
+        auto data = std::to_string(std::rand() % 700);
+        list.insert_sorted(data.c_str());
+        reference.push_back(data);
+    }
+    std::sort(reference.begin(), reference.end());
+    ASSERT_TRUE(list.sorted());
+    for (auto i = 0u; i < reference.size(); ++i) {
+        ASSERT_STREQ(reference[i].c_str(), list[i]);
+    }
+    for (auto value = 0; value < 800; ++value) {
+        auto data = std::to_string(value);
+        auto first = std::lower_bound(reference.begin(), reference.end(),
+                                      data);
+        auto expected = first != reference.end() && *first == data ?
+                        first - reference.begin() : reference.size();
+        ASSERT_EQ(static_cast<std::size_t>(expected),
+                  list.find(data.c_str()));
+        auto range = list.starts_with(data.c_str());
+        auto count = std::count_if(reference.begin(), reference.end(),
+                                   [&](const std::string& s) {
+                                       return s.compare(0, data.size(),
+                                                        data) == 0;
+                                   });
+        ASSERT_EQ(static_cast<std::size_t>(first - reference.begin()),
+                  range.first);
+        ASSERT_EQ(static_cast<std::size_t>(count),
+                  range.second - range.first);
+    }
+    auto all = list.starts_with("");
+    ASSERT_EQ(0u, all.first);
+    ASSERT_EQ(list.size(), all.second);
+}
+
+TEST_F(ArrayListStringTest, SortedInvariant) {
+    ASSERT_TRUE(list.sorted());
+    list.push_back("Blumenau");
+    list.push_back("Lages");
+    list.insert("Chapeco", 1u);
+    ASSERT_TRUE(list.sorted());
+    list.push_front("Palhoca");
+    ASSERT_FALSE(list.sorted());
+    ASSERT_THROW(list.starts_with("B"), std::logic_error);
+    ASSERT_EQ(2u, list.find("Chapeco"));
+    delete[] list.pop_front();
+    ASSERT_FALSE(list.sorted());
+    list.sort();
+    ASSERT_TRUE(list.sorted());
+    list.insert_sorted("Criciuma");
+    ASSERT_STREQ("Criciuma", list[2]);
+    list.remove("Chapeco");
+    ASSERT_EQ(1u, list.find("Criciuma"));
+    list.push_back("Abelardo_Luz");
+    ASSERT_FALSE(list.sorted());
+    list.clear();
+    ASSERT_TRUE(list.sorted());
+}
+
+TEST(SimdStringTest, MismatchAndCompare) {
+    for (auto size = 0u; size < 100u; ++size) {
+        std::string a(size, 'x');
+        for (auto i = 0u; i < size; ++i) {
+            a[i] = static_cast<char>('a' + std::rand() % 26);
+        }
+        ASSERT_EQ(size, structures::simd::mismatch(a.data(), a.data(), size));
+        ASSERT_EQ(0, structures::simd::compare(a.data(), size,
+                                               a.data(), size));
+        for (auto position = 0u; position < size; ++position) {
+            auto b = a;
+            // byte acima de 127: a ordem é a de unsigned char, como strcmp
+            b[position] = '\xe9';
+            ASSERT_EQ(position, structures::simd::mismatch(a.data(),
+                                                           b.data(), size));
+            ASSERT_FALSE(structures::simd::equal(a.data(), b.data(), size));
+            ASSERT_LT(structures::simd::compare(a.data(), size,
+                                                b.data(), size), 0);
+            ASSERT_GT(structures::simd::compare(b.data(), size,
+                                                a.data(), position + 1), 0);
+        }
+        if (size > 0) {
+            ASSERT_GT(structures::simd::compare(a.data(), size,
+                                                a.data(), size - 1), 0);
+        }
+    }
+}
+
+#if defined(STRUCTURES_SIMD_X86)
+TEST(SimdStringTest, EveryKernel) {
+    // sse2 também nos tamanhos que o processador com AVX2 não lhe manda
+    for (auto size = 16u; size < 150u; ++size) {
+        std::string a(size, 'x');
+        for (auto position = 0u; position <= size; ++position) {
+            auto b = a;
+            if (position < size) {
+                b[position] = 'y';
+            }
+            ASSERT_EQ(position, structures::simd::sse2::mismatch(
+                a.data(), b.data(), size));
+            if (structures::simd::has_avx2() && size >= 32u) {
+                ASSERT_EQ(position, structures::simd::avx2::mismatch(
+                    a.data(), b.data(), size));
+            }
+        }
+    }
+}
+#endif
+
+TEST(ArrayListStringChurnTest, LongStringsSurviveCompaction) {
+    // muitas strings longas retiradas: a arena é compactada e as que
+    // ficaram na lista continuam certas
+    structures::ArrayListString list{64u};
+    std::vector<std::string> kept;
+    for (auto i = 0; i < 8; ++i) {
+        kept.push_back("permanece_na_lista_" + std::to_string(i));
+        list.push_back(kept.back().c_str());
+    }
+    for (auto i = 0; i < 20000; ++i) {
+        auto data = "entra_e_sai_logo_em_seguida_" + std::to_string(i);
+        list.push_back(data.c_str());
+        ASSERT_EQ(data, popped(list.pop_back()));
+        list.push_back("curta");
+        ASSERT_EQ("curta", popped(list.pop_back()));
+    }
+    ASSERT_EQ(kept.size(), list.size());
+    for (auto i = 0u; i < kept.size(); ++i) {
+        ASSERT_STREQ(kept[i].c_str(), list[i]);
+        ASSERT_EQ(i, list.find(kept[i].c_str()));
+    }
+}
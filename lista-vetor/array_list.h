@@ -2,11 +2,25 @@
 #ifndef STRUCTURES_ARRAY_LIST_H
 #define STRUCTURES_ARRAY_LIST_H
 
+#include <algorithm>  // std::move, std::move_backward
 #include <cstdint>
+#include <cstring>  // std::memmove
+#include <memory>  // std::allocator_traits
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_trivially_copyable
+#include <utility>  // std::move, std::forward
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+#include "simd_find.h"
+#include "sort.h"
+#include "thread_pool.h"
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 //! Classe Lista em vetor
 class ArrayList {
  public:
@@ -14,18 +28,39 @@ class ArrayList {
   ArrayList();
   //! construtor parametrizado
   explicit ArrayList(std::size_t max_size);
+  //! construtor simples, vetor base reservado com allocator
+  explicit ArrayList(const Allocator& allocator);
+  //! construtor parametrizado, vetor base reservado com allocator
+  ArrayList(std::size_t max_size, const Allocator& allocator);
   //! destrutor
   ~ArrayList();
   //! limpa lista
   void clear();
   //! adiciona ao final
   void push_back(const T& data);
+  //! adiciona ao final, movendo o dado
+  void push_back(T&& data);
   //! adiciona à frente
   void push_front(const T& data);
+  //! adiciona à frente, movendo o dado
+  void push_front(T&& data);
   //! adiciona na posição
   void insert(const T& data, std::size_t index);
+  //! adiciona na posição, movendo o dado
+  void insert(T&& data, std::size_t index);
   //! adiciona em ordem
   void insert_sorted(const T& data);
+  //! adiciona em ordem, movendo o dado
+  void insert_sorted(T&& data);
+  //! constrói ao final
+  template<typename... Args>
+  void emplace_back(Args&&... args);
+  //! constrói à frente
+  template<typename... Args>
+  void emplace_front(Args&&... args);
+  //! constrói na posição
+  template<typename... Args>
+  void emplace(std::size_t index, Args&&... args);
   //! retira da posição
   T pop(std::size_t index);
   //! retira do final
@@ -46,6 +81,30 @@ class ArrayList {
   std::size_t size() const;
   //! retorna tamanho máximo
   std::size_t max_size() const;
+  //! ordena (radix para inteiros; introsort nos demais), sem threads
+  void sort();
+  //! ordena (radix para inteiros; merge sort paralelo em pool nos demais)
+  void sort(ThreadPool& pool);
+  //! conta elementos que satisfazem pred
+  template<typename Predicate>
+  std::size_t count_if(Predicate pred) const;
+  //! conta elementos que satisfazem pred, em paralelo em pool
+  template<typename Predicate>
+  std::size_t count_if(Predicate pred, ThreadPool& pool) const;
+  //! dobra da esquerda para a direita: op(...op(op(init, x0), x1)..., xn)
+  template<typename U, typename BinaryOp>
+  U reduce(U init, BinaryOp op) const;
+  //! reduz em paralelo em pool: cada faixa parte de identity e dobra seus
+  //! elementos com fold(acc, x); as faixas se juntam com combine(a, b),
+  //! que deve ser associativa e ter identity como neutro
+  template<typename U, typename Fold, typename Combine>
+  U reduce(U identity, Fold fold, Combine combine, ThreadPool& pool) const;
+  //! aplica fn a cada elemento
+  template<typename Function>
+  void for_each(Function fn);
+  //! aplica fn a cada elemento, em paralelo em pool
+  template<typename Function>
+  void for_each(Function fn, ThreadPool& pool);
   //! retorna elemento da posição com verificação
   T& at(std::size_t index);
   //! retorna elemento da posição
@@ -54,10 +113,49 @@ class ArrayList {
   const T& at(std::size_t index) const;
   //! retorna elemento da posição com verificação
   const T& operator[](std::size_t index) const;
+  //! iterador de acesso aleatório
+  using Iterator = T*;
+  //! iterador de acesso aleatório, só leitura
+  using ConstIterator = const T*;
+  //! primeiro elemento
+  Iterator begin();
+  //! depois do último elemento
+  Iterator end();
+  //! primeiro elemento, só leitura
+  ConstIterator begin() const;
+  //! depois do último elemento, só leitura
+  ConstIterator end() const;
+  //! primeiro elemento, só leitura
+  ConstIterator cbegin() const;
+  //! depois do último elemento, só leitura
+  ConstIterator cend() const;
 
  private:
   //! verifica sucessor
   bool successor(const T& data1, const T& data2);
+  //! move count elementos de src para dest (faixas podem se sobrepor)
+  void move_range(std::size_t dest, std::size_t src, std::size_t count);
+  //! move_range para T trivialmente copiável: um único memmove
+  void move_range(std::size_t dest, std::size_t src, std::size_t count,
+                  std::true_type);
+  //! move_range para os demais T: atribuição por movimento
+  void move_range(std::size_t dest, std::size_t src, std::size_t count,
+                  std::false_type);
+  //! sort para inteiros: radix sort
+  void sort(ThreadPool* pool, std::true_type);
+  //! sort para os demais T: ordenação por comparação (pool nulo: sem
+  //! threads)
+  void sort(ThreadPool* pool, std::false_type);
+  //! find para T aritmético: kernel vetorizado
+  std::size_t find(const T& data, std::true_type) const;
+  //! find para os demais T: laço com operator==
+  std::size_t find(const T& data, std::false_type) const;
+  //! reserva o vetor base com size elementos construídos
+  T* allocate_contents(std::size_t size);
+  //! destrói os elementos e devolve o vetor base
+  void deallocate_contents();
+  //! alocador do vetor base
+  Allocator allocator_;
   //! vetor base
   T* contents;
   //! tamanho
@@ -66,145 +164,212 @@ class ArrayList {
   std::size_t max_size_;
   //! tamanho default
   static const auto DEFAULT_MAX = 10u;
+  //! mínimo de elementos por thread nas operações paralelas
+  static const auto PARALLEL_GRAIN = 1u << 15;
 };
 
-}  // namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! ArrayList com vetor base em um std::pmr::memory_resource
 template<typename T>
-structures::ArrayList<T>::ArrayList(std::size_t max_size) {
+using ArrayList =
+    structures::ArrayList<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(std::size_t max_size):
+  ArrayList(max_size, Allocator())
+{}
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(std::size_t max_size,
+                                               const Allocator& allocator):
+  allocator_{allocator}
+{
   size_ = 0;
   max_size_ = max_size;
-  contents = new T[max_size];
+  contents = allocate_contents(max_size);
 }
 
-template<typename T>
-structures::ArrayList<T>::ArrayList() {
-  ArrayList(std::size_t(DEFAULT_MAX));
-}
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList():
+  ArrayList(std::size_t(DEFAULT_MAX))
+{}
 
-template<typename T>
-structures::ArrayList<T>::~ArrayList() {
-  delete[] contents;
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(const Allocator& allocator):
+  ArrayList(std::size_t(DEFAULT_MAX), allocator)
+{}
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::~ArrayList() {
+  deallocate_contents();
 }
 
-template<typename T>
-void structures::ArrayList<T>::clear() {
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::clear() {
   size_ = 0;
 }
 
-template<typename T>
-void structures::ArrayList<T>::push_back(const T& data) {
-  if (full()) {
-    throw std::out_of_range("Lista cheia");
-  }
-  size_ += 1;
-  contents[size_ - 1] = data;
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_back(const T& data) {
+  emplace_back(data);
 }
 
-template<typename T>
-void structures::ArrayList<T>::push_front(const T& data) {
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_back(T&& data) {
+  emplace_back(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_front(const T& data) {
+  emplace_front(data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_front(T&& data) {
+  emplace_front(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert(
+    const T& data, std::size_t index) {
+  emplace(index, data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert(T&& data, std::size_t index) {
+  emplace(index, std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert_sorted(const T& data) {
+  insert_sorted(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert_sorted(T&& data) {
   if (full()) {
     throw std::out_of_range("Lista cheia");
   }
-  size_ += 1;
-  for (auto i = size() - 1; i >= 1; i--) {
-    contents[i] = contents[i - 1];
+  // busca binária pela primeira posição que não antecede data
+  std::size_t pos = 0;
+  std::size_t end = size_;
+  while (pos < end) {
+    auto middle = pos + (end - pos) / 2;
+    if (successor(data, contents[middle])) {
+      pos = middle + 1;
+    } else {
+      end = middle;
+    }
   }
-  contents[0] = data;
+  insert(std::move(data), pos);
 }
 
-template<typename T>
-void structures::ArrayList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::ArrayList<T, Allocator>::emplace_back(Args&&... args) {
   if (full()) {
     throw std::out_of_range("Lista cheia");
   }
-  if (index > size()) {
-    throw std::out_of_range("Index Out of Range");
-  }
-  for (auto i = size(); i > index; i--) {
-    contents[i] = contents[i - 1];
-  }
+  contents[size_] = T(std::forward<Args>(args)...);
   size_ += 1;
-  contents[index] = data;
 }
 
-template<typename T>
-void structures::ArrayList<T>::insert_sorted(const T& data) {
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::ArrayList<T, Allocator>::emplace_front(Args&&... args) {
+  emplace(0u, std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::ArrayList<T, Allocator>::emplace(
+    std::size_t index, Args&&... args) {
   if (full()) {
     throw std::out_of_range("Lista cheia");
   }
-  std::size_t pos = 0;
-  while (pos < size_ && successor(data, contents[pos])) {
-    pos += 1;
+  if (index > size()) {
+    throw std::out_of_range("Index Out of Range");
   }
-  insert(data, pos);
+  // constrói antes de deslocar: args pode referenciar um elemento da lista
+  T data(std::forward<Args>(args)...);
+  move_range(index + 1, index, size() - index);
+  size_ += 1;
+  contents[index] = std::move(data);
 }
 
-template<typename T>
-T structures::ArrayList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::pop(std::size_t index) {
   if (index >= size() || index < 0) {
     throw std::out_of_range("Index Out Of Range");
   }
   size_ -= 1;
-  auto data = contents[index];
-  for (auto i = index; i < size(); i++) {
-    contents[i] = contents[i + 1];
-  }
+  auto data = std::move(contents[index]);
+  move_range(index, index + 1, size() - index);
   return data;
 }
 
-template<typename T>
-T structures::ArrayList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::pop_back() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   size_ -= 1;
-  return contents[size()];
+  return std::move(contents[size()]);
 }
 
-template<typename T>
-T structures::ArrayList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::pop_front() {
   if (empty()) {
     throw std::out_of_range("Lista vazia");
   }
   size_ -= 1;
-  auto data = contents[0];
-  for (auto i = 0u; i < size(); i++) {
-    contents[i] = contents[i + 1];
-  }
+  auto data = std::move(contents[0]);
+  move_range(0u, 1u, size());
   return data;
 }
 
-template<typename T>
-void structures::ArrayList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::remove(const T& data) {
   auto index = find(data);
   pop(index);
 }
 
-template<typename T>
-bool structures::ArrayList<T>::full() const {
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::full() const {
   return size_ == max_size_;
 }
 
-template<typename T>
-bool structures::ArrayList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::empty() const {
   return size() == 0u;
 }
 
-template<typename T>
-bool structures::ArrayList<T>::contains(const T& data) const {
-  auto contain = false;
-  for (auto i = 0u; i < size(); i++) {
-    if (contents[i] == data) {
-      contain = true;
-      break;
-    }
-  }
-  return contain;
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::contains(const T& data) const {
+  return find(data) != size();
 }
 
-template<typename T>
-std::size_t structures::ArrayList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::find(const T& data) const {
+  return find(data, simd::has_find<T>());
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::find(
+    const T& data, std::true_type) const {
+  return simd::find(contents, size(), data);
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::find(
+    const T& data, std::false_type) const {
   auto index = size();
   for (auto i = 0u; i < size(); i++) {
     if (contents[i] == data) {
@@ -215,45 +380,255 @@ std::size_t structures::ArrayList<T>::find(const T& data) const {
   return index;
 }
 
-template<typename T>
-std::size_t structures::ArrayList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::size() const {
   return size_;
 }
 
-template<typename T>
-std::size_t structures::ArrayList<T>::max_size() const {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::max_size() const {
   return max_size_;
 }
 
-template<typename T>
-T& structures::ArrayList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::sort() {
+  sort(nullptr, sorting::has_radix_sort<T>());
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::sort(ThreadPool& pool) {
+  sort(&pool, sorting::has_radix_sort<T>());
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::sort(ThreadPool*, std::true_type) {
+  sorting::radix_sort(contents, contents + size());
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::sort(
+    ThreadPool* pool, std::false_type) {
+  auto less = [](const T& data1, const T& data2) {
+    return data2 > data1;
+  };
+  if (pool == nullptr) {
+    sorting::introsort(contents, contents + size(), less);
+  } else {
+    sorting::parallel_sort(contents, contents + size(), less, *pool);
+  }
+}
+
+template<typename T, typename Allocator>
+template<typename Predicate>
+std::size_t structures::ArrayList<T, Allocator>::count_if(
+    Predicate pred) const {
+  std::size_t count = 0;
+  for (auto i = 0u; i < size(); i++) {
+    if (pred(contents[i])) {
+      count++;
+    }
+  }
+  return count;
+}
+
+template<typename T, typename Allocator>
+template<typename Predicate>
+std::size_t structures::ArrayList<T, Allocator>::count_if(Predicate pred,
+                                               ThreadPool& pool) const {
+  std::vector<std::size_t> partials(pool.chunks(size(), PARALLEL_GRAIN));
+  pool.for_chunks(size(), PARALLEL_GRAIN,
+                  [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+    std::size_t count = 0;
+    for (auto i = begin; i < end; i++) {
+      if (pred(contents[i])) {
+        count++;
+      }
+    }
+    partials[chunk] = count;
+  });
+  std::size_t count = 0;
+  for (auto partial : partials) {
+    count += partial;
+  }
+  return count;
+}
+
+template<typename T, typename Allocator>
+template<typename U, typename BinaryOp>
+U structures::ArrayList<T, Allocator>::reduce(U init, BinaryOp op) const {
+  for (auto i = 0u; i < size(); i++) {
+    init = op(std::move(init), contents[i]);
+  }
+  return init;
+}
+
+template<typename T, typename Allocator>
+template<typename U, typename Fold, typename Combine>
+U structures::ArrayList<T, Allocator>::reduce(U identity, Fold fold,
+                                   Combine combine, ThreadPool& pool) const {
+  // cada faixa parte do neutro: elementos só passam por fold, e
+  // resultados parciais só por combine
+  auto chunks = pool.chunks(size(), PARALLEL_GRAIN);
+  std::vector<U> partials(chunks, identity);
+  pool.for_chunks(size(), PARALLEL_GRAIN,
+                  [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+    auto partial = partials[chunk];
+    for (auto i = begin; i < end; i++) {
+      partial = fold(std::move(partial), contents[i]);
+    }
+    partials[chunk] = std::move(partial);
+  });
+  for (auto& partial : partials) {
+    identity = combine(std::move(identity), std::move(partial));
+  }
+  return identity;
+}
+
+template<typename T, typename Allocator>
+template<typename Function>
+void structures::ArrayList<T, Allocator>::for_each(Function fn) {
+  for (auto i = 0u; i < size(); i++) {
+    fn(contents[i]);
+  }
+}
+
+template<typename T, typename Allocator>
+template<typename Function>
+void structures::ArrayList<T, Allocator>::for_each(
+    Function fn, ThreadPool& pool) {
+  pool.for_chunks(size(), PARALLEL_GRAIN,
+                  [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; i++) {
+      fn(contents[i]);
+    }
+  });
+}
+
+template<typename T, typename Allocator>
+T& structures::ArrayList<T, Allocator>::at(std::size_t index) {
   if (index >= size() || index < 0) {
     throw std::out_of_range("Index Out Of Range");
   }
   return contents[index];
 }
 
-template<typename T>
-const T& structures::ArrayList<T>::at(std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::ArrayList<T, Allocator>::at(std::size_t index) const {
   if (index >= size() || index < 0) {
     throw std::out_of_range("Index Out Of Range");
   }
   return contents[index];
 }
 
-template<typename T>
-T& structures::ArrayList<T>::operator[](std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::ArrayList<T, Allocator>::operator[](std::size_t index) {
   return contents[index];
 }
 
-template<typename T>
-const T& structures::ArrayList<T>::operator[](std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::ArrayList<T, Allocator>::operator[](
+    std::size_t index) const {
   return contents[index];
 }
 
-template<typename T>
-bool structures::ArrayList<T>::successor(const T& data1, const T& data2) {
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::Iterator
+structures::ArrayList<T, Allocator>::begin() {
+  return contents;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::Iterator
+structures::ArrayList<T, Allocator>::end() {
+  return contents + size_;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::ConstIterator
+structures::ArrayList<T, Allocator>::begin() const {
+  return contents;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::ConstIterator
+structures::ArrayList<T, Allocator>::end() const {
+  return contents + size_;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::ConstIterator
+structures::ArrayList<T, Allocator>::cbegin() const {
+  return begin();
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::ConstIterator
+structures::ArrayList<T, Allocator>::cend() const {
+  return end();
+}
+
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::successor(
+    const T& data1, const T& data2) {
   return data1 > data2;
 }
 
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::move_range(
+    std::size_t dest, std::size_t src, std::size_t count) {
+  move_range(dest, src, count, std::is_trivially_copyable<T>());
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::move_range(
+    std::size_t dest, std::size_t src, std::size_t count, std::true_type) {
+  if (count > 0) {
+    std::memmove(contents + dest, contents + src, count * sizeof(T));
+  }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::move_range(
+    std::size_t dest, std::size_t src, std::size_t count, std::false_type) {
+  if (dest < src) {
+    std::move(contents + src, contents + src + count, contents + dest);
+  } else {
+    std::move_backward(contents + src, contents + src + count,
+                       contents + dest + count);
+  }
+}
+
+template<typename T, typename Allocator>
+T* structures::ArrayList<T, Allocator>::allocate_contents(std::size_t size) {
+  using Traits = std::allocator_traits<Allocator>;
+  auto data = Traits::allocate(allocator_, size);
+  // como new T[size]: tipos triviais ficam sem inicializar
+  if (!std::is_trivially_default_constructible<T>::value) {
+    std::size_t i = 0;
+    try {
+      for (; i < size; i++) {
+        Traits::construct(allocator_, data + i);
+      }
+    } catch (...) {
+      while (i > 0) {
+        Traits::destroy(allocator_, data + --i);
+      }
+      Traits::deallocate(allocator_, data, size);
+      throw;
+    }
+  }
+  return data;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::deallocate_contents() {
+  using Traits = std::allocator_traits<Allocator>;
+  if (!std::is_trivially_destructible<T>::value) {
+    for (auto i = 0u; i < max_size_; i++) {
+      Traits::destroy(allocator_, contents + i);
+    }
+  }
+  Traits::deallocate(allocator_, contents, max_size_);
+}
+
 #endif
@@ -0,0 +1,54 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de inserção/remoção na frente e no meio da ArrayList.
+// Compilar: g++ -O2 -std=c++14 bench_array_list.cpp -o bench_array_list
+#include <chrono>
+#include <cstdio>
+#include "array_list.h"
+
+//! Estrutura pequena trivialmente copiável
+struct Point {
+  int x;
+  int y;
+  int z;
+};
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Roda push_front, insert no meio e pop_front para um tipo
+template<typename T>
+void bench(const char* name, std::size_t n) {
+  structures::ArrayList<T> list(n);
+  auto front = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      list.push_front(T());
+    }
+  });
+  auto pop = measure([&] {
+    while (!list.empty()) {
+      list.pop_front();
+    }
+  });
+  auto middle = measure([&] {
+    for (auto i = 0u; i < n; i++) {
+      list.insert(T(), list.size() / 2);
+    }
+  });
+  std::printf("%-8s n=%-7zu push_front %9.2f ms  pop_front %9.2f ms  "
+              "insert(meio) %9.2f ms\n", name, n, front, pop, middle);
+}
+
+int main() {
+  for (auto n : {1000u, 10000u, 50000u}) {
+    bench<int>("int", n);
+    bench<double>("double", n);
+    bench<Point>("Point", n);
+  }
+  return 0;
+}
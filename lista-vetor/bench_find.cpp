@@ -0,0 +1,63 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de ArrayList::find vetorizado contra o laço escalar.
+// Compilar: g++ -O2 -std=c++14 bench_find.cpp -o bench_find
+// (os kernels AVX2 são escolhidos em tempo de execução, sem -mavx2)
+#include <chrono>
+#include <cstdio>
+#include "array_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Busca escalar, como o find original
+template<typename T>
+std::size_t scalar_find(const structures::ArrayList<T>& list, const T& data) {
+  for (auto i = 0u; i < list.size(); i++) {
+    if (list[i] == data) {
+      return i;
+    }
+  }
+  return list.size();
+}
+
+//! Procura um valor ausente (pior caso) em listas de vários tamanhos
+template<typename T>
+void bench(const char* name) {
+  for (std::size_t n : {16u, 256u, 4096u, 65536u, 1048576u, 10000000u}) {
+    structures::ArrayList<T> list(n);
+    for (auto i = 0u; i < n; i++) {
+      list.push_back(static_cast<T>(i % 100));
+    }
+    auto repetitions = 200000000u / n;
+    auto missing = static_cast<T>(101);
+    volatile std::size_t sink = 0;
+    auto scalar = measure([&] {
+      for (auto r = 0u; r < repetitions; r++) {
+        sink = sink + scalar_find(list, missing);
+      }
+    });
+    auto vector = measure([&] {
+      for (auto r = 0u; r < repetitions; r++) {
+        sink = sink + list.find(missing);
+      }
+    });
+    auto elements = 1e-6 * repetitions * n;
+    std::printf("%-7s n=%-9zu escalar %8.0f Melem/s  simd %8.0f Melem/s  "
+                "(%.1fx)\n", name, n, elements / scalar * 1000,
+                elements / vector * 1000, scalar / vector);
+  }
+}
+
+int main() {
+  bench<int>("int");
+  bench<float>("float");
+  bench<double>("double");
+  bench<char>("char");
+  return 0;
+}
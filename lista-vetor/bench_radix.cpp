@@ -0,0 +1,55 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de ordenação de inteiros: radix sort x introsort.
+// Compilar: g++ -O2 -std=c++14 -pthread bench_radix.cpp -o bench_radix
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include "array_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Preenche a lista com n valores pseudoaleatórios de T
+template<typename T>
+void fill(structures::ArrayList<T>& list, std::size_t n) {
+  std::mt19937_64 random(42);
+  list.clear();
+  for (auto i = 0u; i < n; i++) {
+    list.push_back(static_cast<T>(random()));
+  }
+}
+
+//! Compara introsort e radix_sort sobre n elementos de T
+template<typename T>
+void bench(const char* name, std::size_t n) {
+  structures::ArrayList<T> list(n);
+  fill(list, n);
+  auto introsort = measure([&] {
+    structures::sorting::introsort(&list[0], &list[0] + n,
+                                   [](const T& data1, const T& data2) {
+                                     return data2 > data1;
+                                   });
+  });
+  fill(list, n);
+  auto radix = measure([&] {
+    structures::sorting::radix_sort(&list[0], &list[0] + n);
+  });
+  std::printf("%-8s n=%-9zu introsort %8.2f ms  radix_sort %8.2f ms  "
+              "(%.2fx)\n", name, n, introsort, radix, introsort / radix);
+}
+
+int main() {
+  for (std::size_t n : {1000000u, 10000000u}) {
+    bench<std::int32_t>("int32", n);
+    bench<std::uint32_t>("uint32", n);
+    bench<std::int64_t>("int64", n);
+  }
+  return 0;
+}
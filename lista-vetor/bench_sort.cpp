@@ -0,0 +1,76 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+// Benchmark de ordenação e reduções da ArrayList.
+// Compilar: g++ -O2 -std=c++14 -pthread bench_sort.cpp -o bench_sort
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "array_list.h"
+
+//! Mede o tempo (ms) de fn
+template<typename F>
+double measure(F fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+//! Preenche a lista com n inteiros pseudoaleatórios
+void fill(structures::ArrayList<int>& list, std::size_t n) {
+  std::srand(42);
+  list.clear();
+  for (auto i = 0u; i < n; i++) {
+    list.push_back(std::rand());
+  }
+}
+
+int main() {
+  structures::ThreadPool pool;
+  std::printf("threads no pool: %zu\n", pool.size());
+  for (std::size_t n : {10000u, 100000u, 1000000u, 10000000u}) {
+    structures::ArrayList<int> list(n);
+    // insert_sorted é O(n^2): só nas listas menores
+    double insert_sorted = 0;
+    if (n <= 100000u) {
+      insert_sorted = measure([&] {
+        std::srand(42);
+        for (auto i = 0u; i < n; i++) {
+          list.insert_sorted(std::rand());
+        }
+      });
+    }
+    fill(list, n);
+    auto introsort = measure([&] {
+      structures::sorting::introsort(&list[0], &list[0] + n,
+                                     [](int data1, int data2) {
+                                       return data2 > data1;
+                                     });
+    });
+    fill(list, n);
+    auto parallel = measure([&] { list.sort(pool); });
+    std::printf("n=%-9zu insert_sorted %9.2f ms  introsort %8.2f ms  "
+                "sort(pool) %8.2f ms\n", n, insert_sorted, introsort, parallel);
+  }
+
+  structures::ArrayList<int> list(10000000u);
+  fill(list, 10000000u);
+  long long sequential = 0;
+  auto loop = measure([&] {
+    for (auto i = 0u; i < list.size(); i++) {
+      sequential += list[i] % 3 == 0 ? 1 : 0;
+    }
+  });
+  std::size_t counted = 0;
+  auto count_if = measure([&] {
+    counted = list.count_if([](int x) { return x % 3 == 0; }, pool);
+  });
+  long long sum = 0;
+  auto reduce = measure([&] {
+    auto add = [](long long a, long long b) { return a + b; };
+    sum = list.reduce(0ll, add, add, pool);
+  });
+  std::printf("n=10000000  laço %6.2f ms  count_if %6.2f ms  reduce %6.2f ms"
+              "  (%lld, %zu, %lld)\n", loop, count_if, reduce, sequential,
+              counted, sum);
+  return 0;
+}
@@ -0,0 +1,337 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_SIMD_FIND_H
+#define STRUCTURES_SIMD_FIND_H
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+//! x86-64: SSE2 sempre existe; AVX2 é verificado em tempo de execução
+#define STRUCTURES_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+//! Busca vetorizada (SSE2/AVX2) em vetores de tipos aritméticos.
+/*!
+  Os kernels de cada conjunto de instruções ficam em um namespace
+  próprio (sse2, avx2) e os de AVX2 são compilados com
+  __attribute__((target("avx2"))), independentemente das flags -m da
+  unidade de tradução. A escolha é feita em tempo de execução, uma vez,
+  por has_avx2(). Assim toda unidade de tradução vê as mesmas definições
+  (sem violar a ODR) e um binário compilado sem -mavx2 ainda usa AVX2 no
+  processador que o tem. Fora do x86-64, laço escalar.
+*/
+namespace structures {
+namespace simd {
+
+//! Verifica se existe kernel vetorizado para T
+template<typename T>
+struct has_find : std::integral_constant<bool,
+#if defined(STRUCTURES_SIMD_X86)
+    (std::is_integral<T>::value &&
+     (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+    || std::is_same<T, float>::value || std::is_same<T, double>::value
+#else
+    false
+#endif
+> {};
+
+#if defined(STRUCTURES_SIMD_X86)
+
+//! Verifica (só na primeira chamada) se o processador tem AVX2
+inline bool has_avx2() {
+  static const bool supported =
+      (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+  return supported;
+}
+
+//! Kernels de 16 bytes: existem em todo x86-64
+namespace sse2 {
+
+//! Registrador usado pelos kernels
+using Register = __m128i;
+
+inline Register load(const void* address) {
+  return _mm_loadu_si128(static_cast<const Register*>(address));
+}
+
+inline Register either(Register a, Register b) {
+  return _mm_or_si128(a, b);
+}
+
+inline std::uint32_t mask(Register a) {
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(a));
+}
+
+//! Comparação por igualdade, especializada por tamanho/tipo do elemento
+template<typename T, typename Enable = void>
+struct Lane;
+
+//! Inteiros de 1 byte
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 1>::type> {
+  static Register set(T value) {
+    return _mm_set1_epi8(static_cast<char>(value));
+  }
+  static Register equal(Register a, Register b) {
+    return _mm_cmpeq_epi8(a, b);
+  }
+};
+
+//! Inteiros de 2 bytes
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 2>::type> {
+  static Register set(T value) {
+    return _mm_set1_epi16(static_cast<std::int16_t>(value));
+  }
+  static Register equal(Register a, Register b) {
+    return _mm_cmpeq_epi16(a, b);
+  }
+};
+
+//! Inteiros de 4 bytes
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 4>::type> {
+  static Register set(T value) {
+    return _mm_set1_epi32(static_cast<std::int32_t>(value));
+  }
+  static Register equal(Register a, Register b) {
+    return _mm_cmpeq_epi32(a, b);
+  }
+};
+
+//! Inteiros de 8 bytes
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 8>::type> {
+  static Register set(T value) {
+    return _mm_set1_epi64x(static_cast<long long>(value));  // NOLINT
+  }
+  static Register equal(Register a, Register b) {
+    // SSE2 não compara 64 bits: combina as duas metades de 32 bits
+    auto halves = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(halves,
+                         _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+};
+
+//! float (mesma semântica de ==: NaN nunca é igual, -0.0 == 0.0)
+template<>
+struct Lane<float> {
+  static Register set(float value) {
+    return _mm_castps_si128(_mm_set1_ps(value));
+  }
+  static Register equal(Register a, Register b) {
+    return _mm_castps_si128(
+        _mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+  }
+};
+
+//! double (mesma semântica de ==)
+template<>
+struct Lane<double> {
+  static Register set(double value) {
+    return _mm_castpd_si128(_mm_set1_pd(value));
+  }
+  static Register equal(Register a, Register b) {
+    return _mm_castpd_si128(
+        _mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+  }
+};
+
+//! Posição da primeira ocorrência de value em data[0, size), ou size
+template<typename T>
+std::size_t find(const T* data, std::size_t size, T value) {
+  constexpr std::size_t step = sizeof(Register) / sizeof(T);
+  std::size_t i = 0;
+  auto needle = Lane<T>::set(value);
+  // quatro registradores por iteração; ao achar, o laço seguinte localiza
+  for (; i + 4 * step <= size; i += 4 * step) {
+    auto a = Lane<T>::equal(load(data + i), needle);
+    auto b = Lane<T>::equal(load(data + i + step), needle);
+    auto c = Lane<T>::equal(load(data + i + 2 * step), needle);
+    auto d = Lane<T>::equal(load(data + i + 3 * step), needle);
+    if (mask(either(either(a, b), either(c, d))) != 0) {
+      break;
+    }
+  }
+  for (; i + step <= size; i += step) {
+    auto found = mask(Lane<T>::equal(load(data + i), needle));
+    if (found != 0) {
+      return i + __builtin_ctz(found) / sizeof(T);
+    }
+  }
+  if (i < size && size >= step) {
+    // último bloco sobreposto ao anterior, que não tinha value
+    i = size - step;
+    auto found = mask(Lane<T>::equal(load(data + i), needle));
+    return found == 0 ? size : i + __builtin_ctz(found) / sizeof(T);
+  }
+  for (; i < size; i++) {
+    if (data[i] == value) {
+      return i;
+    }
+  }
+  return size;
+}
+
+}  // namespace sse2
+
+//! Kernels de 32 bytes: só chamados quando has_avx2()
+namespace avx2 {
+
+//! Compila a função para AVX2, mesmo sem -mavx2
+#define STRUCTURES_AVX2 __attribute__((target("avx2")))
+
+//! Registrador usado pelos kernels
+using Register = __m256i;
+
+STRUCTURES_AVX2 inline Register load(const void* address) {
+  return _mm256_loadu_si256(static_cast<const Register*>(address));
+}
+
+STRUCTURES_AVX2 inline Register either(Register a, Register b) {
+  return _mm256_or_si256(a, b);
+}
+
+STRUCTURES_AVX2 inline std::uint32_t mask(Register a) {
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(a));
+}
+
+//! Comparação por igualdade, especializada por tamanho/tipo do elemento
+template<typename T, typename Enable = void>
+struct Lane;
+
+//! Inteiros de 1 byte
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 1>::type> {
+  STRUCTURES_AVX2 static Register set(T value) {
+    return _mm256_set1_epi8(static_cast<char>(value));
+  }
+  STRUCTURES_AVX2 static Register equal(Register a, Register b) {
+    return _mm256_cmpeq_epi8(a, b);
+  }
+};
+
+//! Inteiros de 2 bytes
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 2>::type> {
+  STRUCTURES_AVX2 static Register set(T value) {
+    return _mm256_set1_epi16(static_cast<std::int16_t>(value));
+  }
+  STRUCTURES_AVX2 static Register equal(Register a, Register b) {
+    return _mm256_cmpeq_epi16(a, b);
+  }
+};
+
+//! Inteiros de 4 bytes
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 4>::type> {
+  STRUCTURES_AVX2 static Register set(T value) {
+    return _mm256_set1_epi32(static_cast<std::int32_t>(value));
+  }
+  STRUCTURES_AVX2 static Register equal(Register a, Register b) {
+    return _mm256_cmpeq_epi32(a, b);
+  }
+};
+
+//! Inteiros de 8 bytes
+template<typename T>
+struct Lane<T, typename std::enable_if<
+    std::is_integral<T>::value && sizeof(T) == 8>::type> {
+  STRUCTURES_AVX2 static Register set(T value) {
+    return _mm256_set1_epi64x(static_cast<long long>(value));  // NOLINT
+  }
+  STRUCTURES_AVX2 static Register equal(Register a, Register b) {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+};
+
+//! float (mesma semântica de ==: NaN nunca é igual, -0.0 == 0.0)
+template<>
+struct Lane<float> {
+  STRUCTURES_AVX2 static Register set(float value) {
+    return _mm256_castps_si256(_mm256_set1_ps(value));
+  }
+  STRUCTURES_AVX2 static Register equal(Register a, Register b) {
+    return _mm256_castps_si256(_mm256_cmp_ps(
+        _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+  }
+};
+
+//! double (mesma semântica de ==)
+template<>
+struct Lane<double> {
+  STRUCTURES_AVX2 static Register set(double value) {
+    return _mm256_castpd_si256(_mm256_set1_pd(value));
+  }
+  STRUCTURES_AVX2 static Register equal(Register a, Register b) {
+    return _mm256_castpd_si256(_mm256_cmp_pd(
+        _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+  }
+};
+
+//! Como sse2::find, para size de pelo menos 32 bytes
+template<typename T>
+STRUCTURES_AVX2 std::size_t find(const T* data, std::size_t size, T value) {
+  constexpr std::size_t step = sizeof(Register) / sizeof(T);
+  std::size_t i = 0;
+  auto needle = Lane<T>::set(value);
+  for (; i + 4 * step <= size; i += 4 * step) {
+    auto a = Lane<T>::equal(load(data + i), needle);
+    auto b = Lane<T>::equal(load(data + i + step), needle);
+    auto c = Lane<T>::equal(load(data + i + 2 * step), needle);
+    auto d = Lane<T>::equal(load(data + i + 3 * step), needle);
+    if (mask(either(either(a, b), either(c, d))) != 0) {
+      break;
+    }
+  }
+  for (; i + step <= size; i += step) {
+    auto found = mask(Lane<T>::equal(load(data + i), needle));
+    if (found != 0) {
+      return i + __builtin_ctz(found) / sizeof(T);
+    }
+  }
+  if (i == size) {
+    return size;
+  }
+  i = size - step;
+  auto found = mask(Lane<T>::equal(load(data + i), needle));
+  return found == 0 ? size : i + __builtin_ctz(found) / sizeof(T);
+}
+
+}  // namespace avx2
+
+#undef STRUCTURES_AVX2
+
+#endif  // STRUCTURES_SIMD_X86
+
+//! Posição da primeira ocorrência de value em data[0, size), ou size
+template<typename T>
+std::size_t find(const T* data, std::size_t size, T value) {
+#if defined(STRUCTURES_SIMD_X86)
+  // menos de 32 bytes não enche um registrador AVX2
+  if (size * sizeof(T) >= sizeof(avx2::Register) && has_avx2()) {
+    return avx2::find(data, size, value);
+  }
+  return sse2::find(data, size, value);
+#else
+  for (std::size_t i = 0; i < size; i++) {
+    if (data[i] == value) {
+      return i;
+    }
+  }
+  return size;
+#endif
+}
+
+}  // namespace simd
+}  // namespace structures
+
+#endif
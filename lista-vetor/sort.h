@@ -0,0 +1,261 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_SORT_H
+#define STRUCTURES_SORT_H
+
+#include <algorithm>  // std::move, std::swap
+#include <cstdint>
+#include <memory>  // std::unique_ptr
+#include <type_traits>
+#include <utility>  // std::move, std::swap
+#include <vector>
+
+#include "thread_pool.h"
+
+//! Algoritmos de ordenação sobre vetores [first, last), com comparador less
+namespace structures {
+namespace sorting {
+
+//! abaixo disso a partição é ordenada por inserção
+const std::size_t INSERTION_LIMIT = 16u;
+//! abaixo disso parallel_sort ordena sequencialmente
+const std::size_t PARALLEL_LIMIT = 1u << 16;
+//! abaixo disso radix_sort usa introsort
+const std::size_t RADIX_LIMIT = 256u;
+
+//! Verifica se radix_sort ordena T (inteiros, exceto bool)
+template<typename T>
+struct has_radix_sort : std::integral_constant<bool,
+    std::is_integral<T>::value && !std::is_same<T, bool>::value> {};
+
+//! ordenação por inserção (estável)
+template<typename T, typename Less>
+void insertion_sort(T* first, T* last, Less less) {
+  for (auto i = first + 1; i < last; i++) {
+    T data = std::move(*i);
+    auto j = i;
+    while (j > first && less(data, *(j - 1))) {
+      *j = std::move(*(j - 1));
+      j--;
+    }
+    *j = std::move(data);
+  }
+}
+
+//! desce o elemento da posição root até restaurar o heap de máximo
+template<typename T, typename Less>
+void sift_down(T* first, std::size_t root, std::size_t size, Less less) {
+  while (2 * root + 1 < size) {
+    auto child = 2 * root + 1;
+    if (child + 1 < size && less(first[child], first[child + 1])) {
+      child++;
+    }
+    if (!less(first[root], first[child])) {
+      return;
+    }
+    std::swap(first[root], first[child]);
+    root = child;
+  }
+}
+
+//! heapsort: O(n log n) no pior caso
+template<typename T, typename Less>
+void heap_sort(T* first, T* last, Less less) {
+  std::size_t size = last - first;
+  for (auto root = size / 2; root > 0; root--) {
+    sift_down(first, root - 1, size, less);
+  }
+  for (auto end = size; end > 1; end--) {
+    std::swap(first[0], first[end - 1]);
+    sift_down(first, 0, end - 1, less);
+  }
+}
+
+//! leva a mediana de first, meio e last - 1 para first
+template<typename T, typename Less>
+void median_to_front(T* first, T* last, Less less) {
+  auto middle = first + (last - first) / 2;
+  auto back = last - 1;
+  if (less(*middle, *first)) {
+    std::swap(*middle, *first);
+  }
+  if (less(*back, *middle)) {
+    std::swap(*back, *middle);
+    if (less(*middle, *first)) {
+      std::swap(*middle, *first);
+    }
+  }
+  std::swap(*first, *middle);
+}
+
+//! introsort limitado a depth níveis de quicksort
+template<typename T, typename Less>
+void introsort(T* first, T* last, Less less, std::size_t depth) {
+  while (static_cast<std::size_t>(last - first) > INSERTION_LIMIT) {
+    if (depth == 0) {
+      return heap_sort(first, last, less);
+    }
+    depth--;
+    median_to_front(first, last, less);
+    // partição de Hoare com o pivô em *first
+    auto i = first;
+    auto j = last;
+    while (true) {
+      do {
+        i++;
+      } while (i < last && less(*i, *first));
+      do {
+        j--;
+      } while (less(*first, *j));
+      if (i >= j) {
+        break;
+      }
+      std::swap(*i, *j);
+    }
+    std::swap(*first, *j);
+    // recursão no lado menor, laço no maior: pilha O(log n)
+    if (j - first < last - (j + 1)) {
+      introsort(first, j, less, depth);
+      first = j + 1;
+    } else {
+      introsort(j + 1, last, less, depth);
+      last = j;
+    }
+  }
+  insertion_sort(first, last, less);
+}
+
+//! introsort: quicksort com mediana de três, heapsort se degenerar
+template<typename T, typename Less>
+void introsort(T* first, T* last, Less less) {
+  std::size_t depth = 0;
+  for (auto size = last - first; size > 1; size /= 2) {
+    depth += 2;
+  }
+  introsort(first, last, less, depth);
+}
+
+//! intercala (estável) [a, a_end) e [b, b_end) em out, movendo
+template<typename T, typename Less>
+void merge(T* a, T* a_end, T* b, T* b_end, T* out, Less less) {
+  while (a != a_end && b != b_end) {
+    if (less(*b, *a)) {
+      *out++ = std::move(*b++);
+    } else {
+      *out++ = std::move(*a++);
+    }
+  }
+  out = std::move(a, a_end, out);
+  std::move(b, b_end, out);
+}
+
+//! merge sort paralelo: introsort por faixa e intercalação em rodadas
+/*!
+  Cada thread do pool ordena uma faixa; depois as faixas vizinhas são
+  intercaladas duas a duas em paralelo, usando um vetor auxiliar de
+  last - first elementos. O resultado não é estável entre elementos
+  iguais de uma mesma faixa (introsort), mas a intercalação preserva a
+  ordem entre faixas.
+*/
+template<typename T, typename Less>
+void parallel_sort(T* first, T* last, Less less, ThreadPool& pool) {
+  std::size_t size = last - first;
+  auto runs = pool.chunks(size, PARALLEL_LIMIT / 2);
+  if (size < PARALLEL_LIMIT || runs < 2) {
+    return introsort(first, last, less);
+  }
+  // mesmas faixas que for_chunks usa
+  std::vector<std::size_t> bounds(runs + 1);
+  for (auto run = 0u; run <= runs; run++) {
+    bounds[run] = size * run / runs;
+  }
+  pool.for_chunks(size, PARALLEL_LIMIT / 2,
+                  [&](std::size_t, std::size_t begin, std::size_t end) {
+    introsort(first + begin, first + end, less);
+  });
+  std::unique_ptr<T[]> buffer(new T[size]);
+  auto source = first;
+  auto target = buffer.get();
+  for (std::size_t width = 1; width < runs; width *= 2) {
+    auto pairs = (runs + 2 * width - 1) / (2 * width);
+    pool.for_chunks(pairs, 1,
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+      for (auto pair = begin; pair < end; pair++) {
+        auto left = pair * 2 * width;
+        auto middle = std::min(left + width, runs);
+        auto right = std::min(left + 2 * width, runs);
+        merge(source + bounds[left], source + bounds[middle],
+              source + bounds[middle], source + bounds[right],
+              target + bounds[left], less);
+      }
+    });
+    std::swap(source, target);
+  }
+  if (source != first) {
+    std::move(source, source + size, first);
+  }
+}
+
+//! chave sem sinal com a mesma ordem de value
+template<typename T>
+typename std::make_unsigned<T>::type radix_key(T value) {
+  using Key = typename std::make_unsigned<T>::type;
+  auto key = static_cast<Key>(value);
+  if (std::is_signed<T>::value) {
+    // inverte o bit de sinal: negativos passam a vir antes dos positivos
+    key ^= static_cast<Key>(Key(1) << (8 * sizeof(T) - 1));
+  }
+  return key;
+}
+
+//! radix sort LSD para inteiros: um passe de 8 bits por byte da chave
+/*!
+  Estável, O(n * sizeof(T)), usa um vetor auxiliar de last - first
+  elementos. Os histogramas de todos os bytes são contados em uma única
+  leitura, e bytes iguais em todas as chaves não geram passe.
+*/
+template<typename T>
+void radix_sort(T* first, T* last) {
+  static_assert(has_radix_sort<T>::value, "radix_sort requer inteiros");
+  std::size_t size = last - first;
+  if (size < RADIX_LIMIT) {
+    return introsort(first, last, [](const T& data1, const T& data2) {
+      return data2 > data1;
+    });
+  }
+  const std::size_t digits = sizeof(T);
+  std::unique_ptr<std::size_t[]> counts(new std::size_t[digits * 256]());
+  for (auto it = first; it != last; it++) {
+    auto key = radix_key(*it);
+    for (auto digit = 0u; digit < digits; digit++) {
+      counts[digit * 256 + ((key >> (8 * digit)) & 0xff)]++;
+    }
+  }
+  std::unique_ptr<T[]> buffer(new T[size]);
+  auto source = first;
+  auto target = buffer.get();
+  for (auto digit = 0u; digit < digits; digit++) {
+    auto count = counts.get() + digit * 256;
+    auto shift = 8 * digit;
+    if (count[(radix_key(*source) >> shift) & 0xff] == size) {
+      continue;
+    }
+    std::size_t offset = 0;
+    for (auto bucket = 0u; bucket < 256u; bucket++) {
+      auto bucket_size = count[bucket];
+      count[bucket] = offset;
+      offset += bucket_size;
+    }
+    for (auto it = source; it != source + size; it++) {
+      target[count[(radix_key(*it) >> shift) & 0xff]++] = *it;
+    }
+    std::swap(source, target);
+  }
+  if (source != first) {
+    std::copy(source, source + size, first);
+  }
+}
+
+}  // namespace sorting
+}  // namespace structures
+
+#endif
@@ -1,6 +1,19 @@
 #include "gtest/gtest.h"
 #include "array_list.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
 int main(int argc, char* argv[]) {
     std::srand(std::time(NULL));
     ::testing::InitGoogleTest(&argc, argv);
@@ -224,3 +237,408 @@ TEST_F(ArrayListTest, RemoveElement) {
     ASSERT_EQ(9u, list.size());
     ASSERT_FALSE(list.contains(4));
 }
+
+TEST(ArrayListMoveTest, ShiftTriviallyCopyable) {
+    // tipo trivialmente copiável: os deslocamentos de insert e pop são um
+    // memmove, com origem e destino sobrepostos nos dois sentidos
+    struct Point {
+        int x, y, z;
+    };
+    static_assert(std::is_trivially_copyable<Point>::value, "");
+    structures::ArrayList<Point> list{20u};
+    for (auto i = 0; i < 10; ++i) {
+        list.push_front(Point{i, -i, 2 * i});
+    }
+    list.insert(Point{100, -100, 200}, 3u);
+    ASSERT_EQ(8, list.pop(1u).x);
+    ASSERT_EQ(9, list.pop_front().x);
+    auto expected = {7, 100, 6, 5, 4, 3, 2, 1, 0};
+    auto i = 0u;
+    for (auto x : expected) {
+        ASSERT_EQ(x, list[i].x);
+        ASSERT_EQ(-x, list[i].y);
+        ASSERT_EQ(2 * x, list[i].z);
+        i++;
+    }
+    ASSERT_EQ(i, list.size());
+}
+
+TEST(ArrayListMoveTest, ShiftMoveOnly) {
+    // unique_ptr não é trivialmente copiável: desloca por atribuição de
+    // movimento, e cada posição fica com o mesmo objeto apontado
+    structures::ArrayList<std::unique_ptr<int>> list{10u};
+    std::vector<int*> raw;
+    for (auto i = 0; i < 5; ++i) {
+        raw.push_back(new int(i));
+        list.emplace_front(raw.back());
+    }
+    auto ten = new int(10);
+    list.emplace(2u, ten);
+    ASSERT_EQ(raw[3], list.pop(1u).get());
+    ASSERT_EQ(raw[4], list.pop_front().get());
+    auto expected = {ten, raw[2], raw[1], raw[0]};
+    auto i = 0u;
+    for (auto pointer : expected) {
+        ASSERT_EQ(pointer, list[i++].get());
+    }
+    ASSERT_EQ(i, list.size());
+}
+
+TEST(ArrayListMoveTest, ShiftNonTrivialElements) {
+    structures::ArrayList<std::string> list{10u};
+    for (auto i = 0; i < 5; ++i) {
+        list.push_front(std::to_string(i));
+    }
+    list.insert("x", 2u);
+    ASSERT_EQ("4", list[0]);
+    ASSERT_EQ("x", list[2]);
+    ASSERT_EQ("0", list[5]);
+    ASSERT_EQ("x", list.pop(2u));
+    for (auto i = 4; i >= 0; --i) {
+        ASSERT_EQ(std::to_string(i), list.pop_front());
+    }
+}
+
+TEST_F(ArrayListTest, InsertInOrderWithDuplicates) {
+    for (auto i : {3, 1, 3, 2, 1, 0, 3}) {
+        list.insert_sorted(i);
+    }
+    auto expected = {0, 1, 1, 2, 3, 3, 3};
+    auto i = 0u;
+    for (auto value : expected) {
+        ASSERT_EQ(value, list[i++]);
+    }
+}
+
+TEST(ArrayListDefaultTest, DefaultConstructor) {
+    structures::ArrayList<int> list;
+    ASSERT_EQ(10u, list.max_size());
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_TRUE(list.full());
+}
+
+template<typename T>
+class ArrayListFindTest: public ::testing::Test {};
+
+using FindTypes = ::testing::Types<char, unsigned char, std::int16_t,
+    int, unsigned, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_CASE(ArrayListFindTest, FindTypes);
+
+TYPED_TEST(ArrayListFindTest, EveryPosition) {
+    structures::ArrayList<TypeParam> list{300u};
+    for (auto i = 0; i < 300; ++i) {
+        list.push_back(static_cast<TypeParam>(i % 100 + 1));
+    }
+    for (auto i = 0u; i < 100u; ++i) {
+        ASSERT_EQ(i, list.find(static_cast<TypeParam>(i + 1)));
+        ASSERT_TRUE(list.contains(static_cast<TypeParam>(i + 1)));
+    }
+    ASSERT_EQ(list.size(), list.find(static_cast<TypeParam>(0)));
+    ASSERT_FALSE(list.contains(static_cast<TypeParam>(101)));
+    for (auto size = 299; size > 0; size -= 7) {
+        while (static_cast<int>(list.size()) > size) {
+            list.pop_front();
+        }
+        ASSERT_EQ(0u, list.find(list[0]));
+        auto last = list.size() - 1;
+        auto index = list.find(list[last]);
+        ASSERT_EQ(list[last], list[index]);
+        ASSERT_TRUE(index <= last && index < 100u);
+    }
+}
+
+#if defined(STRUCTURES_SIMD_X86)
+TYPED_TEST(ArrayListFindTest, EveryKernel) {
+    // cada kernel direto, não só o escolhido para este processador
+    std::vector<TypeParam> data;
+    for (auto size = 0u; size < 80u; ++size) {
+        for (auto position = 0u; position <= size; ++position) {
+            data.assign(size, static_cast<TypeParam>(1));
+            if (position < size) {
+                data[position] = static_cast<TypeParam>(2);
+            }
+            auto needle = static_cast<TypeParam>(2);
+            ASSERT_EQ(position, structures::simd::sse2::find(
+                data.data(), size, needle));
+            if (structures::simd::has_avx2() &&
+                size * sizeof(TypeParam) >= 32u) {
+                ASSERT_EQ(position, structures::simd::avx2::find(
+                    data.data(), size, needle));
+            }
+        }
+    }
+}
+#endif
+
+TEST(ArrayListFindFloatTest, FloatingPointEquality) {
+    structures::ArrayList<double> list{40u};
+    for (auto i = 0; i < 39; ++i) {
+        list.push_back(std::nan(""));
+    }
+    list.push_back(-0.0);
+    ASSERT_FALSE(list.contains(std::nan("")));
+    ASSERT_EQ(39u, list.find(0.0));
+}
+
+class ArrayListParallelTest: public ::testing::Test {
+protected:
+    structures::ThreadPool pool{4u};
+    structures::ArrayList<int> list{300000u};
+
+    void SetUp() override {
+        for (auto i = 0; i < 300000; ++i) {
+            list.push_back(std::rand() % 1000 - 500);
+        }
+    }
+};
+
+TEST_F(ArrayListTest, Sort) {
+    for (auto i : {5, -3, 9, 0, 5, 1, -8, 2, 7, 4}) {
+        list.push_back(i);
+    }
+    list.sort();
+    for (auto i = 1u; i < list.size(); ++i) {
+        ASSERT_FALSE(list[i - 1] > list[i]);
+    }
+    ASSERT_EQ(-8, list[0]);
+    ASSERT_EQ(9, list[9]);
+}
+
+TEST_F(ArrayListParallelTest, SortLargeList) {
+    auto add = [](long long a, long long b) { return a + b; };
+    auto sum = list.reduce(0ll, add, add, pool);
+    list.sort(pool);
+    for (auto i = 1u; i < list.size(); ++i) {
+        ASSERT_FALSE(list[i - 1] > list[i]);
+    }
+    ASSERT_EQ(sum, list.reduce(0ll, add, add, pool));
+}
+
+TEST_F(ArrayListParallelTest, SortDegenerateInputs) {
+    list.clear();
+    for (auto i = 0; i < 200000; ++i) {
+        list.push_back(i % 2 == 0 ? i : 200000 - i);
+    }
+    list.sort(pool);
+    for (auto i = 1u; i < list.size(); ++i) {
+        ASSERT_FALSE(list[i - 1] > list[i]);
+    }
+    list.clear();
+    for (auto i = 0; i < 200000; ++i) {
+        list.push_back(7);
+    }
+    list.sort(pool);
+    ASSERT_EQ(200000u, list.size());
+    ASSERT_EQ(7, list[199999]);
+}
+
+TEST_F(ArrayListParallelTest, SortStrings) {
+    structures::ArrayList<std::string> strings{100000u};
+    for (auto i = 0; i < 100000; ++i) {
+        strings.push_back(std::to_string(std::rand()));
+    }
+    strings.sort(pool);
+    for (auto i = 1u; i < strings.size(); ++i) {
+        ASSERT_FALSE(strings[i - 1] > strings[i]);
+    }
+}
+
+TEST_F(ArrayListParallelTest, Reductions) {
+    long long sum = 0;
+    std::size_t negatives = 0;
+    for (auto i = 0u; i < list.size(); ++i) {
+        sum += list[i];
+        negatives += list[i] < 0 ? 1 : 0;
+    }
+    auto add = [](long long a, long long b) { return a + b; };
+    ASSERT_EQ(sum, list.reduce(0ll, add, add, pool));
+    ASSERT_EQ(sum, list.reduce(0ll, add));
+    ASSERT_EQ(sum + 10, list.reduce(10ll, add));
+    ASSERT_EQ(negatives, list.count_if([](int x) { return x < 0; }, pool));
+    list.for_each([](int& x) { x *= 2; }, pool);
+    ASSERT_EQ(2 * sum, list.reduce(0ll, add, add, pool));
+    ASSERT_EQ(negatives, list.count_if([](int x) { return x < 0; }));
+    list.for_each([](int& x) { x /= 2; });
+    ASSERT_EQ(sum, list.reduce(0ll, add));
+}
+
+TEST_F(ArrayListParallelTest, ReduceTransformingFold) {
+    // fold transforma o elemento; combine só soma os parciais
+    auto squares = [](long long acc, int x) {
+        return acc + static_cast<long long>(x) * x;
+    };
+    auto add = [](long long a, long long b) { return a + b; };
+    long long expected = 0;
+    for (auto i = 0u; i < list.size(); ++i) {
+        expected += static_cast<long long>(list[i]) * list[i];
+    }
+    ASSERT_EQ(expected, list.reduce(0ll, squares));
+    ASSERT_EQ(expected, list.reduce(0ll, squares, add, pool));
+}
+
+TEST_F(ArrayListTest, ReduceIsLeftFold) {
+    list.push_back(3);
+    list.push_back(4);
+    ASSERT_EQ(25, list.reduce(0, [](int a, int x) { return a + x * x; }));
+    ASSERT_EQ(34, list.reduce(0, [](int a, int x) { return a * 10 + x; }));
+}
+
+TEST(ArrayListNestedTest, NestedCallsOnSamePool) {
+    // tarefas do pool que chamam o mesmo pool rodam as faixas na thread
+    // atual em vez de esperar por tarefas que nunca rodariam
+    structures::ThreadPool pool{2u};
+    structures::ArrayList<int> list{200000u};
+    for (auto i = 0; i < 200000; ++i) {
+        list.push_back(i % 4);
+    }
+    std::vector<std::size_t> counts(8u);
+    pool.for_chunks(8u, 1u, [&](std::size_t, std::size_t begin,
+                                std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            counts[i] = list.count_if([](int x) { return x == 0; }, pool);
+        }
+    });
+    for (auto count : counts) {
+        ASSERT_EQ(50000u, count);
+    }
+}
+
+TEST_F(ArrayListTest, ReduceEmpty) {
+    ASSERT_EQ(3, list.reduce(3, [](int a, int b) { return a + b; }));
+    structures::ThreadPool pool{2u};
+    auto add = [](int a, int b) { return a + b; };
+    ASSERT_EQ(0, list.reduce(0, add, add, pool));
+    ASSERT_EQ(0u, list.count_if([](int) { return true; }));
+}
+
+template<typename T>
+class ArrayListRadixTest: public ::testing::Test {};
+
+using RadixTypes = ::testing::Types<signed char, unsigned char, short,
+    int, unsigned, std::int64_t, std::uint64_t>;
+TYPED_TEST_CASE(ArrayListRadixTest, RadixTypes);
+
+TYPED_TEST(ArrayListRadixTest, SortsLikeComparison) {
+    for (auto size : {0u, 1u, 100u, 5000u}) {
+        structures::ArrayList<TypeParam> list{size + 2};
+        for (auto i = 0u; i < size; ++i) {
+            auto value = static_cast<TypeParam>(
+                (static_cast<std::uint64_t>(std::rand()) << 33) ^
+                (static_cast<std::uint64_t>(std::rand()) << 10) ^
+                static_cast<std::uint64_t>(std::rand()));
+            list.push_back(value);
+        }
+        list.push_back(std::numeric_limits<TypeParam>::min());
+        list.push_back(std::numeric_limits<TypeParam>::max());
+        list.sort();
+        ASSERT_EQ(size + 2, list.size());
+        ASSERT_EQ(std::numeric_limits<TypeParam>::min(), list[0]);
+        ASSERT_EQ(std::numeric_limits<TypeParam>::max(), list[size + 1]);
+        for (auto i = 1u; i < list.size(); ++i) {
+            ASSERT_FALSE(list[i - 1] > list[i]);
+        }
+    }
+}
+
+TEST_F(ArrayListParallelTest, SortDoubles) {
+    structures::ArrayList<double> doubles{200000u};
+    for (auto i = 0; i < 200000; ++i) {
+        doubles.push_back(std::rand() / 7.0 - 1e8);
+    }
+    doubles.sort(pool);
+    for (auto i = 1u; i < doubles.size(); ++i) {
+        ASSERT_FALSE(doubles[i - 1] > doubles[i]);
+    }
+}
+
+//! Alocador que conta os elementos reservados e não devolvidos
+template<typename T>
+class CountingAllocator {
+ public:
+    using value_type = T;
+    explicit CountingAllocator(std::size_t* count): count_{count} {}
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other):  // NOLINT
+        count_{other.count()}
+    {}
+    T* allocate(std::size_t n) {
+        *count_ += n;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* data, std::size_t n) {
+        *count_ -= n;
+        std::allocator<T>().deallocate(data, n);
+    }
+    std::size_t* count() const {
+        return count_;
+    }
+
+ private:
+    std::size_t* count_;
+};
+
+template<typename T, typename U>
+bool operator==(const CountingAllocator<T>& a, const CountingAllocator<U>& b) {
+    return a.count() == b.count();
+}
+
+template<typename T, typename U>
+bool operator!=(const CountingAllocator<T>& a, const CountingAllocator<U>& b) {
+    return !(a == b);
+}
+
+TEST(ArrayListAllocatorTest, ContentsFromAllocator) {
+    std::size_t count = 0;
+    {
+        using Allocator = CountingAllocator<std::string>;
+        structures::ArrayList<std::string, Allocator> list{8u,
+                                                           Allocator{&count}};
+        ASSERT_EQ(8u, count);
+        list.push_back("b");
+        list.emplace_front(3u, 'a');
+        list.insert_sorted("c");
+        ASSERT_EQ("aaa", list.pop_front());
+        ASSERT_EQ("c", list.pop_back());
+        ASSERT_EQ("b", list[0]);
+    }
+    ASSERT_EQ(0u, count);
+}
+
+#if __cplusplus >= 201703L
+TEST(ArrayListPmrTest, ContentsInOneAllocation) {
+    // o vetor é reservado inteiro no construtor: 64 ints cabem em um
+    // buffer de 64 ints, e sem memória a falha vem na construção
+    alignas(std::max_align_t) char buffer[64 * sizeof(int)];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    {
+        structures::pmr::ArrayList<int> container{64u, &resource};
+        for (auto i = 0; i < 64; i++) {
+            container.push_back(i);
+        }
+        ASSERT_TRUE(container.full());
+        for (auto i = 0; i < 64; i++) {
+            ASSERT_EQ(i, container.pop_front());
+        }
+        ASSERT_TRUE(container.empty());
+    }
+    using Container = structures::pmr::ArrayList<int>;
+    ASSERT_THROW(Container(1u, &resource), std::bad_alloc);
+}
+#endif
+
+TEST_F(ArrayListTest, Iterators) {
+    ASSERT_TRUE(list.begin() == list.end());
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(9 - i);
+    }
+    std::sort(list.begin(), list.end());
+    for (auto i = 0u; i < list.size(); ++i) {
+        ASSERT_EQ(static_cast<int>(i), list[i]);
+    }
+    const auto& const_list = list;
+    ASSERT_EQ(45, std::accumulate(const_list.begin(), const_list.end(), 0));
+    ASSERT_EQ(10, list.end() - list.begin());
+}
@@ -0,0 +1,177 @@
+// Copyright [2026] <Gabriel de Vargas Coelho...>
+#ifndef STRUCTURES_THREAD_POOL_H
+#define STRUCTURES_THREAD_POOL_H
+
+#include <algorithm>  // std::max, std::min
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace structures {
+
+//! Conjunto fixo de threads que executam tarefas de uma fila
+class ThreadPool {
+ public:
+  //! construtor: threads == 0 usa o número de núcleos
+  explicit ThreadPool(std::size_t threads = 0);
+  //! não copiável
+  ThreadPool(const ThreadPool&) = delete;
+  //! não copiável
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  //! destrutor: termina as tarefas pendentes e junta as threads
+  ~ThreadPool();
+  //! enfileira uma tarefa
+  template<typename F>
+  std::future<void> submit(F task);
+  //! quantidade de faixas que for_chunks usa para count itens
+  std::size_t chunks(std::size_t count, std::size_t grain) const;
+  //! divide [0, count) em faixas e roda fn(faixa, início, fim) em paralelo
+  /*!
+    Cada faixa tem pelo menos grain itens; a última roda na thread que
+    chamou. Chamada de dentro de uma tarefa do próprio pool, roda todas
+    as faixas na thread atual: esperar por tarefas enfileiradas atrás
+    dela travaria o pool quando todas as threads esperassem.
+  */
+  template<typename F>
+  void for_chunks(std::size_t count, std::size_t grain, F fn);
+  //! quantidade de threads
+  std::size_t size() const;
+  //! pool compartilhado pelas estruturas
+  static ThreadPool& shared();
+
+ private:
+  //! laço de cada thread
+  void work();
+  //! pool cuja tarefa a thread atual está rodando (nullptr: nenhum)
+  static const ThreadPool*& current();
+  //! threads
+  std::vector<std::thread> workers_;
+  //! tarefas pendentes
+  std::queue<std::function<void()>> tasks_;
+  //! protege tasks_ e stopping_
+  std::mutex mutex_;
+  //! avisa que há tarefa ou que o pool vai parar
+  std::condition_variable ready_;
+  //! pool sendo destruído
+  bool stopping_{false};
+};
+
+}  // namespace structures
+
+inline structures::ThreadPool::ThreadPool(std::size_t threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (auto i = 0u; i < threads; i++) {
+    workers_.emplace_back([this] { work(); });
+  }
+}
+
+inline structures::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  ready_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+template<typename F>
+std::future<void> structures::ThreadPool::submit(F task) {
+  auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+  auto future = packaged->get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.emplace([packaged] { (*packaged)(); });
+  }
+  ready_.notify_one();
+  return future;
+}
+
+inline std::size_t structures::ThreadPool::chunks(std::size_t count,
+                                                  std::size_t grain) const {
+  auto by_grain = grain == 0 ? count : count / grain;
+  return std::max<std::size_t>(1u, std::min(size(), by_grain));
+}
+
+template<typename F>
+void structures::ThreadPool::for_chunks(std::size_t count, std::size_t grain,
+                                        F fn) {
+  auto total = chunks(count, grain);
+  if (current() == this) {
+    for (auto chunk = 0u; chunk < total; chunk++) {
+      fn(chunk, count * chunk / total, count * (chunk + 1) / total);
+    }
+    return;
+  }
+  std::vector<std::future<void>> pending;
+  for (auto chunk = 0u; chunk + 1 < total; chunk++) {
+    auto begin = count * chunk / total;
+    auto end = count * (chunk + 1) / total;
+    pending.push_back(submit([&fn, chunk, begin, end] {
+      fn(chunk, begin, end);
+    }));
+  }
+  // espera todas as faixas mesmo com erro: as tarefas referenciam fn
+  std::exception_ptr error;
+  try {
+    fn(total - 1, count * (total - 1) / total, count);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (auto& future : pending) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+inline std::size_t structures::ThreadPool::size() const {
+  return workers_.size();
+}
+
+inline structures::ThreadPool& structures::ThreadPool::shared() {
+  static ThreadPool pool;
+  return pool;
+}
+
+inline const structures::ThreadPool*& structures::ThreadPool::current() {
+  thread_local const ThreadPool* pool = nullptr;
+  return pool;
+}
+
+inline void structures::ThreadPool::work() {
+  current() = this;
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+      if (stopping_ && tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+#endif
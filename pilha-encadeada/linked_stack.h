@@ -1,19 +1,35 @@
 //! Copyright [2021] Gabriel de Vargas Coelho
+#ifndef STRUCTURES_LINKED_STACK
+#define STRUCTURES_LINKED_STACK
+
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
 //! Classe pilha encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class LinkedStack {
  public:
   //! Construtor
   LinkedStack();
+  //! Construtor, nós reservados com allocator
+  explicit LinkedStack(const Allocator& allocator);
   //! Destrutor
   ~LinkedStack();
   //! Limpa pilha
   void clear();
   //! Empilha
   void push(const T& data);
+  //! Empilha, movendo o dado
+  void push(T&& data);
+  //! Empilha construindo no topo
+  template<typename... Args>
+  void emplace(Args&&... args);
   //! Desempilha
   T pop();
   //! Topo
@@ -27,14 +43,10 @@ class LinkedStack {
   //! Classe nó
   class Node {
    public:
-    //! Construtor
-    explicit Node(const T& data):
-      data_{data}
-    {}
-    //! Construtor parametrizado
-    Node(const T& data, Node* next):
-      data_{data},
-      next_{next}
+    //! Construtor, dado construído no lugar
+    template<typename... Args>
+    explicit Node(Args&&... args):
+      data_(std::forward<Args>(args)...)
     {}
     //! Retorna dado
     T& data() {
@@ -63,74 +75,139 @@ class LinkedStack {
     //! Próximo nó
     Node* next_{nullptr};
   };
+  //! Alocador de nós
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  //! Operações do alocador de nós
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  //! Reserva e constrói um nó
+  template<typename... Args>
+  Node* create_node(Args&&... args);
+  //! Destrói e devolve um nó
+  void destroy_node(Node* node);
+  //! Reserva os nós
+  NodeAllocator allocator_;
   //! Topo
   Node* top_{nullptr};
   //! Tamanho
   std::size_t size_{0u};
 };
 
-}  //  namespace structures
+#if __cplusplus >= 201703L
+namespace pmr {
 
+//! LinkedStack com nós em um std::pmr::memory_resource
 template<typename T>
-structures::LinkedStack<T>::LinkedStack() {
+using LinkedStack =
+    structures::LinkedStack<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
+}  //  namespace structures
+
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::LinkedStack() {
   top_ = nullptr;
   size_ = 0;
 }
 
-template<typename T>
-structures::LinkedStack<T>::~LinkedStack() {
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::LinkedStack(const Allocator& allocator):
+  allocator_{allocator}
+{
+  top_ = nullptr;
+  size_ = 0;
+}
+
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::~LinkedStack() {
   clear();
 }
 
-template<typename T>
-void structures::LinkedStack<T>::clear() {
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::clear() {
   Node* current = top_;
   while (current != nullptr) {
     auto next = current->next();
-    delete current;
+    destroy_node(current);
     current = next;
   }
   top_ = nullptr;
   size_ = 0;
 }
 
-template<typename T>
-void structures::LinkedStack<T>::push(const T& data) {
-  Node* new_top = new Node(data, top_);
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::push(const T& data) {
+  emplace(data);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::push(T&& data) {
+  emplace(std::move(data));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::LinkedStack<T, Allocator>::emplace(Args&&... args) {
+  Node* new_top = create_node(std::forward<Args>(args)...);
   if (new_top == nullptr) {
     throw std::out_of_range("Pilha cheia");
   }
+  new_top->next(top_);
   top_ = new_top;
   size_++;
 }
 
-template<typename T>
-T structures::LinkedStack<T>::pop() {
+template<typename T, typename Allocator>
+T structures::LinkedStack<T, Allocator>::pop() {
   if (empty()) {
     throw std::out_of_range("Pilha vazia");
   }
   auto previous_head = top_;
-  auto data = previous_head->data();
+  auto data = std::move(previous_head->data());
   top_ = previous_head->next();
   size_--;
-  delete previous_head;
+  destroy_node(previous_head);
   return data;
 }
 
-template<typename T>
-T& structures::LinkedStack<T>::top() const {
+template<typename T, typename Allocator>
+T& structures::LinkedStack<T, Allocator>::top() const {
   if (empty()) {
     throw std::out_of_range("Pilha vazia");
   }
   return top_->data();
 }
 
-template<typename T>
-bool structures::LinkedStack<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::LinkedStack<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template<typename T>
-std::size_t structures::LinkedStack<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedStack<T, Allocator>::size() const {
   return size_;
 }
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::LinkedStack<T, Allocator>::Node*
+structures::LinkedStack<T, Allocator>::create_node(Args&&... args) {
+  auto node = NodeTraits::allocate(allocator_, 1);
+  try {
+    NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(allocator_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::destroy_node(Node* node) {
+  NodeTraits::destroy(allocator_, node);
+  NodeTraits::deallocate(allocator_, node, 1);
+}
+
+#endif
@@ -2,6 +2,13 @@
 
 #include "gtest/gtest.h"
 #include "linked_stack.h"
+#include "../lista-encadeada/node_pool.h"
+
+#include <memory>
+#include <string>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 #include <stdexcept>
 
@@ -63,3 +70,71 @@ TEST_F(LinkedStackTest, Pop) {
 TEST_F(LinkedStackTest, PopEmpty) {
     ASSERT_THROW(stack.pop(), std::out_of_range);
 }
+
+TEST(LinkedStackMoveTest, MovedThroughTop) {
+    // o nó guarda o próprio objeto recebido: top e pop devolvem o mesmo
+    // buffer da string longa, e unique_ptr entra e sai só por movimento
+    structures::LinkedStack<std::string> container{};
+    std::string data(40, 'a');
+    auto buffer = data.data();
+    container.push(std::move(data));
+    container.emplace(2u, 'b');
+    ASSERT_EQ("bb", container.pop());
+    ASSERT_EQ(buffer, container.top().data());
+    ASSERT_EQ(buffer, container.pop().data());
+    structures::LinkedStack<std::unique_ptr<int>> pointers{};
+    pointers.emplace(new int(0));
+    pointers.push(std::unique_ptr<int>(new int(1)));
+    ASSERT_EQ(1, *pointers.pop());
+    ASSERT_EQ(0, *pointers.top());
+}
+
+TEST(LinkedStackPoolTest, PopThenPushReusesTopBlock) {
+    // o pool entrega primeiro o último bloco devolvido: depois de pop, o
+    // push seguinte põe o novo topo no mesmo bloco
+    structures::NodePool pool;
+    {
+        structures::PoolAllocator<std::string> allocator{pool};
+        structures::LinkedStack<std::string,
+            structures::PoolAllocator<std::string>> container{allocator};
+        for (auto i = 0; i < 100; i++) {
+            container.push(std::to_string(i));
+        }
+        auto slabs = pool.slabs();
+        for (auto i = 0; i < 1000; i++) {
+            auto top = &container.top();
+            container.pop();
+            container.push(std::to_string(i));
+            ASSERT_EQ(top, &container.top());
+        }
+        ASSERT_EQ(100u, pool.used());
+        ASSERT_EQ(slabs, pool.slabs());
+    }
+    ASSERT_EQ(0u, pool.used());
+}
+
+#if __cplusplus >= 201703L
+TEST(LinkedStackPmrTest, FailedPushKeepsTop) {
+    // o nó novo só vira o topo depois de reservado e construído
+    alignas(std::max_align_t) char buffer[1 << 10];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    structures::pmr::LinkedStack<int> container{&resource};
+    auto pushed = 0;
+    try {
+        for (; pushed < 1000; pushed++) {
+            container.push(pushed);
+        }
+    } catch (const std::bad_alloc&) {
+    }
+    ASSERT_GT(pushed, 0);
+    ASSERT_LT(pushed, 1000);
+    ASSERT_THROW(container.emplace(-1), std::bad_alloc);
+    ASSERT_EQ(pushed - 1, container.top());
+    for (auto i = pushed - 1; i >= 0; i--) {
+        ASSERT_EQ(i, container.pop());
+    }
+    ASSERT_TRUE(container.empty());
+}
+
+#endif
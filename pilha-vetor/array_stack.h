@@ -3,11 +3,17 @@
 #define STRUCTURES_ARRAY_STACK_H
 
 #include <cstdint>  // std::size_t
+#include <memory>  // std::allocator, std::allocator_traits
 #include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_trivially_destructible
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 //! CLASSE PILHA
 class ArrayStack {
  public:
@@ -15,10 +21,19 @@ class ArrayStack {
     ArrayStack();
     //! construtor com parametro tamanho
     explicit ArrayStack(std::size_t max);
+    //! construtor padrão, vetor base reservado com allocator
+    explicit ArrayStack(const Allocator& allocator);
+    //! construtor com parametro, vetor base reservado com allocator
+    ArrayStack(std::size_t max, const Allocator& allocator);
     //! destrutor
     ~ArrayStack();
     //! metodo empilha
     void push(const T& data);
+    //! metodo empilha, movendo o dado
+    void push(T&& data);
+    //! metodo empilha construindo no topo
+    template<typename... Args>
+    void emplace(Args&&... args);
     //! metodo desempilha
     T pop();
     //! metodo retorna o topo
@@ -35,6 +50,12 @@ class ArrayStack {
     bool full();
 
  private:
+    //! reserva o vetor base com size elementos construídos
+    T* allocate_contents(std::size_t size);
+    //! destrói os elementos e devolve o vetor base
+    void deallocate_contents();
+    //! alocador do vetor base
+    Allocator allocator_;
     //! vetor base
     T* contents;
     //! índice do topo da pilha
@@ -45,52 +66,89 @@ class ArrayStack {
     static const auto DEFAULT_SIZE = 10u;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+
+//! ArrayStack com vetor base em um std::pmr::memory_resource
+template<typename T>
+using ArrayStack =
+    structures::ArrayStack<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
 #endif
 
 
-template<typename T>
-structures::ArrayStack<T>::ArrayStack() {
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack() {
     max_size_ = DEFAULT_SIZE;
-    contents = new T[max_size_];
+    contents = allocate_contents(max_size_);
     top_ = -1;
 }
 
-template<typename T>
-structures::ArrayStack<T>::ArrayStack(std::size_t max) {
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(std::size_t max) {
     max_size_ = max;
-    contents = new T[max];
+    contents = allocate_contents(max);
     top_ = -1;
 }
 
-template<typename T>
-structures::ArrayStack<T>::~ArrayStack() {
-    delete [] contents;
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(const Allocator& allocator):
+    ArrayStack(std::size_t(DEFAULT_SIZE), allocator)
+{}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(std::size_t max,
+                                                 const Allocator& allocator):
+    allocator_{allocator}
+{
+    max_size_ = max;
+    contents = allocate_contents(max);
+    top_ = -1;
 }
 
-template<typename T>
-void structures::ArrayStack<T>::push(const T& data) {
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::~ArrayStack() {
+    deallocate_contents();
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::push(const T& data) {
+    emplace(data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void structures::ArrayStack<T, Allocator>::emplace(Args&&... args) {
     if (full()) {
         throw std::out_of_range("pilha cheia");
     } else {
+        contents[top_ + 1] = T(std::forward<Args>(args)...);
         top_++;
-        contents[top_] = data;
     }
 }
 
-template<typename T>
-T structures::ArrayStack<T>::pop() {
+template<typename T, typename Allocator>
+T structures::ArrayStack<T, Allocator>::pop() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     }
-    auto data = contents[top_];
+    auto data = std::move(contents[top_]);
     top_--;
     return data;
 }
 
-template<typename T>
-T& structures::ArrayStack<T>::top() {
+template<typename T, typename Allocator>
+T& structures::ArrayStack<T, Allocator>::top() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     } else {
@@ -98,28 +156,61 @@ T& structures::ArrayStack<T>::top() {
     }
 }
 
-template<typename T>
-void structures::ArrayStack<T>::clear() {
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::clear() {
     top_ = -1;
 }
 
-template<typename T>
-std::size_t structures::ArrayStack<T>::size() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayStack<T, Allocator>::size() {
     return top_ + 1;
 }
 
-template<typename T>
-std::size_t structures::ArrayStack<T>::max_size() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayStack<T, Allocator>::max_size() {
     return max_size_;
 }
 
-template<typename T>
-bool structures::ArrayStack<T>::empty() {
+template<typename T, typename Allocator>
+bool structures::ArrayStack<T, Allocator>::empty() {
     return top_ == -1;
 }
 
-template<typename T>
-bool structures::ArrayStack<T>::full() {
+template<typename T, typename Allocator>
+bool structures::ArrayStack<T, Allocator>::full() {
     auto one = std::size_t(1);
     return top_ + one >= max_size_;
 }
+
+template<typename T, typename Allocator>
+T* structures::ArrayStack<T, Allocator>::allocate_contents(std::size_t size) {
+    using Traits = std::allocator_traits<Allocator>;
+    auto data = Traits::allocate(allocator_, size);
+    // como new T[size]: tipos triviais ficam sem inicializar
+    if (!std::is_trivially_default_constructible<T>::value) {
+        std::size_t i = 0;
+        try {
+            for (; i < size; i++) {
+                Traits::construct(allocator_, data + i);
+            }
+        } catch (...) {
+            while (i > 0) {
+                Traits::destroy(allocator_, data + --i);
+            }
+            Traits::deallocate(allocator_, data, size);
+            throw;
+        }
+    }
+    return data;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::deallocate_contents() {
+    using Traits = std::allocator_traits<Allocator>;
+    if (!std::is_trivially_destructible<T>::value) {
+        for (auto i = 0u; i < max_size_; i++) {
+            Traits::destroy(allocator_, contents + i);
+        }
+    }
+    Traits::deallocate(allocator_, contents, max_size_);
+}
@@ -5,6 +5,12 @@
 #include "gtest/gtest.h"
 #include "array_stack.h"
 
+#include <memory>
+#include <string>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
 #include <stdexcept>
 
 int main(int argc, char* argv[]) {
@@ -76,3 +82,49 @@ TEST_F(ArrayStackTest, Pop) {
 TEST_F(ArrayStackTest, PopFromEmptyStack) {
     ASSERT_THROW(stack.pop(), std::out_of_range);
 }
+
+TEST(ArrayStackMoveTest, RefillsMovedFromSlots) {
+    // pop deixa na posição um objeto de onde se moveu; o push seguinte
+    // atribui por movimento sobre ele, sem copiar
+    structures::ArrayStack<std::string> container{2u};
+    for (auto round = 0; round < 3; ++round) {
+        std::string data(40, static_cast<char>('a' + round));
+        auto buffer = data.data();
+        container.push(std::move(data));
+        container.emplace(2u, 'z');
+        ASSERT_TRUE(container.full());
+        ASSERT_EQ("zz", container.pop());
+        ASSERT_EQ(buffer, container.top().data());
+        ASSERT_EQ(buffer, container.pop().data());
+    }
+    structures::ArrayStack<std::unique_ptr<int>> pointers{2u};
+    pointers.emplace(new int(0));
+    pointers.push(std::unique_ptr<int>(new int(1)));
+    ASSERT_EQ(1, *pointers.pop());
+    pointers.emplace(new int(2));
+    ASSERT_EQ(2, *pointers.pop());
+    ASSERT_EQ(0, *pointers.pop());
+}
+
+#if __cplusplus >= 201703L
+TEST(ArrayStackPmrTest, ContentsInOneAllocation) {
+    // o vetor é reservado inteiro no construtor: 64 ints cabem em um
+    // buffer de 64 ints, e sem memória a falha vem na construção
+    alignas(std::max_align_t) char buffer[64 * sizeof(int)];
+    std::pmr::monotonic_buffer_resource resource{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    {
+        structures::pmr::ArrayStack<int> container{64u, &resource};
+        for (auto i = 0; i < 64; i++) {
+            container.push(i);
+        }
+        ASSERT_TRUE(container.full());
+        for (auto i = 63; i >= 0; i--) {
+            ASSERT_EQ(i, container.pop());
+        }
+        ASSERT_TRUE(container.empty());
+    }
+    using Container = structures::pmr::ArrayStack<int>;
+    ASSERT_THROW(Container(1u, &resource), std::bad_alloc);
+}
+#endif
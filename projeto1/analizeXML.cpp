@@ -5,6 +5,7 @@
 #include <string>
 #include <fstream>
 #include <exception>
+#include <utility>
 #include "linked_stack.h"
 
 //! Erro de XML mal formado
@@ -66,7 +67,7 @@ class AnalizeXML {
       line.replace(close_tag_index, 1, "#");
 
       try {
-        handle_stack(tag);
+        handle_stack(std::move(tag));
       } catch (MalformadException& e) {
         formatted_ = false;
         break;
@@ -77,12 +78,12 @@ class AnalizeXML {
   /*!
     \param tag um std::string representando uma tag xml sem <>
   */
-  void handle_stack(std::string& tag) {
+  void handle_stack(std::string tag) {
     if (tag.compare(0, 1, "/") != 0) {
-      stack_.push(tag);
+      stack_.push(std::move(tag));
       return;
     }
-    auto tag_stack_top = stack_.top();
+    const auto& tag_stack_top = stack_.top();
     if (tag.compare(1, tag.size(), tag_stack_top) != 0) {
       throw MalformadException();
     }